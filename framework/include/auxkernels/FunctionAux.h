@@ -39,8 +39,17 @@ public:
 protected:
   virtual Real computeValue() override;
 
+  /// Evaluate the function at all quadrature points of the element at once
+  virtual void precalculateValue() override;
+
   /// Function being used to compute the value of this kernel
   Function & _func;
+
+  /// The quadrature points of the current element
+  std::vector<Point> _points;
+
+  /// The function values at the quadrature points of the current element
+  std::vector<Real> _values;
 };
 
 #endif // FUNCTIONAUX_H
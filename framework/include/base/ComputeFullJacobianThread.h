@@ -17,6 +17,9 @@
 
 #include "ComputeJacobianThread.h"
 
+// C++ includes
+#include <unordered_set>
+
 // Forward declarations
 class FEProblem;
 class NonlinearSystem;
@@ -52,6 +55,9 @@ protected:
 
   // Reference to Kernel storage
   const KernelWarehouse & _kernels;
+
+  /// The Kernels whose contributions vanish on the current element (see KernelBase::skipElement())
+  std::unordered_set<const KernelBase *> _skipped_kernels;
 };
 
 #endif //COMPUTEFULLJACOBIANTHREAD_H
@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPUTENODALINITIALCONDITIONTHREAD_H
+#define COMPUTENODALINITIALCONDITIONTHREAD_H
+
+#include "ThreadedNodeLoop.h"
+
+// libMesh includes
+#include "libmesh/node_range.h"
+
+// Forward declarations
+class FEProblem;
+class InitialCondition;
+
+/**
+ * Sets the initial conditions of first order Lagrange variables that only depend on the
+ * point (see InitialCondition::computesNodal()) by evaluating them once per local node.
+ */
+class ComputeNodalInitialConditionThread : public ThreadedNodeLoop<ConstNodeRange, ConstNodeRange::const_iterator>
+{
+public:
+  ComputeNodalInitialConditionThread(FEProblem & fe_problem);
+
+  // Splitting Constructor
+  ComputeNodalInitialConditionThread(ComputeNodalInitialConditionThread & x, Threads::split split);
+
+  void onNode(ConstNodeRange::const_iterator & nd);
+
+  void join(const ComputeNodalInitialConditionThread & /*y*/);
+
+protected:
+  /// The initial conditions set at the current node (an initial condition may be active on several of its blocks)
+  std::vector<const InitialCondition *> _computed_ics;
+};
+
+#endif //COMPUTENODALINITIALCONDITIONTHREAD_H
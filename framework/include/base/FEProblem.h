@@ -30,6 +30,7 @@
 #include "ExecuteMooseObjectWarehouse.h"
 #include "AuxGroupExecuteMooseObjectWarehouse.h"
 #include "MaterialWarehouse.h"
+#include "ThreadedLoopScheduler.h"
 
 // libMesh includes
 #include "libmesh/enum_quadrature_type.h"
@@ -978,6 +979,11 @@ public:
 
   void setErrorOnJacobianNonzeroReallocation(bool state) { _error_on_jacobian_nonzero_reallocation = state; }
 
+  /**
+   * The scheduler of the threaded element and node loops of this problem
+   */
+  ThreadedLoopScheduler & loopScheduler() { return _loop_scheduler; }
+
   /// Returns whether or not this Problem has a TimeIntegrator
   bool hasTimeIntegrator() const { return _has_time_integrator; }
 
@@ -1283,6 +1289,9 @@ private:
   /// At or beyond initialSteup stage
   bool _started_initial_setup;
 
+  /// Schedules the threaded loops (by cost, if dynamic_loop_scheduling is set)
+  ThreadedLoopScheduler _loop_scheduler;
+
   friend class AuxiliarySystem;
   friend class NonlinearSystem;
   friend class MooseEigenSystem;
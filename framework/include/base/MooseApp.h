@@ -27,10 +27,12 @@
 
 // libMesh includes
 #include "libmesh/parallel_object.h"
+#include "libmesh/threads.h"
 
 // C++ includes
 #include <list>
 #include <map>
+#include <memory>
 #include <set>
 
 // Forward declarations
@@ -394,6 +396,17 @@ public:
    */
   const RestartableDatas & getRestartableData() { return _restartable_data; }
 
+  /**
+   * The store of read-only data shared between the thread copies of objects (see SharedDataInterface).
+   * The entries are weak references so the data is freed along with the last object using it.
+   */
+  std::map<std::string, std::weak_ptr<void> > & sharedData() { return _shared_data; }
+
+  /**
+   * The mutex that must be held while accessing sharedData()
+   */
+  Threads::spin_mutex & sharedDataMutex() { return _shared_data_mutex; }
+
   /**
    * Return a reference to the recoverable data object
    * @return A const reference to the recoverable data
@@ -644,6 +657,12 @@ private:
   /// Data names that will only be read from the restart file during RECOVERY
   std::set<std::string> _recoverable_data;
 
+  /// Read-only data shared between the thread copies of objects
+  std::map<std::string, std::weak_ptr<void> > _shared_data;
+
+  /// Mutex protecting _shared_data
+  Threads::spin_mutex _shared_data_mutex;
+
   /// Enumeration for holding the valid types of dynamic registrations allowed
   enum RegistrationType { APPLICATION, OBJECT, SYNTAX };
 
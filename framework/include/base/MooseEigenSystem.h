@@ -92,6 +92,18 @@ public:
    */
   bool activeOnOld();
 
+  /**
+   * Set the Wielandt shift k_s of the inverse power iterations, zero for no shift.
+   * With a shift, eigen kernels operate on both the old and the current solution while they
+   * are on old, scaled by 1/k - 1/k_s and 1/k_s respectively.
+   */
+  void setWielandtShift(Real shift);
+
+  /**
+   * Return the Wielandt shift (zero for no shift)
+   */
+  Real wielandtShift() const { return _wielandt_shift; }
+
   /**
    * Get variable names of the eigen system
    */
@@ -110,6 +122,9 @@ protected:
 
   bool _active_on_old;
 
+  /// Wielandt shift of the inverse power iterations
+  Real _wielandt_shift;
+
   /// counter of eigen kernels
   unsigned int _eigen_kernel_counter;
 };
@@ -0,0 +1,47 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERFGRAPHINTERFACE_H
+#define PERFGRAPHINTERFACE_H
+
+#include "MooseTypes.h"
+
+// Forward declarations
+class MooseObject;
+
+/**
+ * Interface for objects that can be timed individually in the performance graph
+ * (see PerfGraph::ObjectGuard). The section is named after the base type and the name of the object
+ * and is shared by all thread copies of the object.
+ */
+class PerfGraphInterface
+{
+public:
+  PerfGraphInterface(const MooseObject * moose_object);
+
+  /// The id of the performance graph section of this object
+  unsigned int perfGraphSectionID() const { return _perf_graph_section_id; }
+
+  /// The thread this object is used on
+  THREAD_ID perfGraphThreadID() const { return _perf_graph_tid; }
+
+private:
+  /// The id of the performance graph section of this object
+  const unsigned int _perf_graph_section_id;
+
+  /// The thread this object is used on
+  const THREAD_ID _perf_graph_tid;
+};
+
+#endif // PERFGRAPHINTERFACE_H
@@ -0,0 +1,88 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SHAREDDATAINTERFACE_H
+#define SHAREDDATAINTERFACE_H
+
+// MOOSE includes
+#include "MooseApp.h"
+
+// Forward declarations
+class InputParameters;
+
+/**
+ * Interface for objects that hold large read-only data (tables, grids, images, ...).
+ *
+ * Most MooseObjects are created once per thread.  Data obtained through getSharedData()
+ * is only built by the first copy of the object and is reused by all of the other
+ * thread copies with the same name.  The data is reference counted and is freed
+ * when the last copy of the object is destroyed.
+ *
+ * The shared data must not be modified after it has been built.
+ */
+class SharedDataInterface
+{
+public:
+  SharedDataInterface(const InputParameters & parameters);
+
+protected:
+  /**
+   * Get the data named data_name that is shared between all thread copies of this object.
+   *
+   * @param data_name A name for the data, unique within this object
+   * @param builder A callable returning a MooseSharedPointer<T>.  It is only called
+   *                if the data does not exist yet, and without holding the store lock.
+   *                Thread copies building the data at the same time all get the data
+   *                of the first one to finish.
+   * @return The shared data
+   */
+  template<typename T, typename Builder>
+  MooseSharedPointer<T> getSharedData(const std::string & data_name, Builder builder);
+
+private:
+  /// The MooseApp holding the shared data store
+  MooseApp & _sdi_app;
+
+  /// The prefix for the keys of this object in the store (base type and object name)
+  const std::string _sdi_key_prefix;
+};
+
+template<typename T, typename Builder>
+MooseSharedPointer<T>
+SharedDataInterface::getSharedData(const std::string & data_name, Builder builder)
+{
+  const std::string key = _sdi_key_prefix + data_name;
+
+  {
+    Threads::spin_mutex::scoped_lock lock(_sdi_app.sharedDataMutex());
+    MooseSharedPointer<void> existing = _sdi_app.sharedData()[key].lock();
+    if (existing)
+      return MooseSharedNamespace::static_pointer_cast<T>(existing);
+  }
+
+  // build without holding the lock, the builder may read files or get other shared data
+  MooseSharedPointer<T> data = builder();
+
+  // if another thread copy published its data in the meantime, use that and drop ours
+  Threads::spin_mutex::scoped_lock lock(_sdi_app.sharedDataMutex());
+  std::weak_ptr<void> & entry = _sdi_app.sharedData()[key];
+  MooseSharedPointer<void> existing = entry.lock();
+  if (existing)
+    return MooseSharedNamespace::static_pointer_cast<T>(existing);
+
+  entry = data;
+  return data;
+}
+
+#endif // SHAREDDATAINTERFACE_H
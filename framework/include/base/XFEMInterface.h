@@ -108,6 +108,11 @@ public:
    */
   virtual void initSolution(NonlinearSystem & nl, AuxiliarySystem & aux) = 0;
 
+  /**
+   * Notify XFEM that the mesh has changed, either by update() or by something else, e.g. adaptivity
+   */
+  virtual void meshChanged() = 0;
+
 
   /**
    * Get the factors for the QP weighs for XFEM partial elements
@@ -68,12 +68,16 @@ public:
    * @param echo True to make screen printouts.
    * @param xdiff Name of the postprocessor evaluating the difference of the solution norm of two successive iterations.
    * @param tol_x Tolerance on the difference of the solution norm of two successive iterations.
+   * @param wielandt_shift Initial increment of the Wielandt shift over the eigenvalue, zero for no shift.
+   * @param min_wielandt_shift Minimum increment of the Wielandt shift over the eigenvalue.
    * @param k Eigenvalue, input as the initial guess.
    * @param initial_res The initial residual.
    */
   virtual void inversePowerIteration(unsigned int min_iter, unsigned int max_iter, Real pfactor,
                                      bool cheb_on, Real tol_eig, bool echo,
-                                     PostprocessorName xdiff, Real tol_x, Real & k, Real & initial_res);
+                                     PostprocessorName xdiff, Real tol_x,
+                                     Real wielandt_shift, Real min_wielandt_shift,
+                                     Real & k, Real & initial_res);
 
   /**
    * Override this for actions that should take place before linear solve of each inverse power iteration
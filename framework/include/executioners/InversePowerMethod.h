@@ -52,6 +52,16 @@ protected:
   const Real & _pfactor;
   /// indicating if Chebyshev acceleration is turned on
   const bool & _cheb_on;
+  /// initial increment of the Wielandt shift over the eigenvalue (zero for no shift)
+  const Real & _wielandt_shift;
+  /// minimum increment of the Wielandt shift over the eigenvalue
+  const Real & _min_wielandt_shift;
+  /// eigenvalue tolerance for switching from power iterations to Newton iterations (zero for no switch)
+  const Real & _newton_switch_tol;
+  /// absolute tolerance of the Newton iterations
+  const Real & _abs_tol;
+  /// relative tolerance of the Newton iterations
+  const Real & _rel_tol;
 };
 
 #endif //INVERSEPOWERMETHOD_H
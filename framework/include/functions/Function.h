@@ -23,6 +23,7 @@
 #include "Restartable.h"
 #include "MeshChangedInterface.h"
 #include "ScalarCoupleable.h"
+#include "SharedDataInterface.h"
 
 // libMesh
 #include "libmesh/vector_value.h"
@@ -51,7 +52,8 @@ class Function :
   public UserObjectInterface,
   public Restartable,
   public MeshChangedInterface,
-  public ScalarCoupleable
+  public ScalarCoupleable,
+  public SharedDataInterface
 {
 public:
   /**
@@ -100,6 +102,36 @@ public:
    */
   virtual Real timeDerivative(Real t, const Point & p);
 
+  /**
+   * Evaluate the function at a set of points (e.g. the quadrature points of an element) at
+   * time t. By default this calls value() for each point, derived classes can override it
+   * to evaluate all points at once. Such an override bypasses value() overrides in classes
+   * derived further, so classes overriding it mark their value() final (see
+   * MooseParsedFunction). The same holds for gradients() and timeDerivatives().
+   * \param t The time
+   * \param points The points in space (x,y,z)
+   * \param results The values of the function at the points
+   */
+  virtual void values(Real t, const std::vector<Point> & points, std::vector<Real> & results);
+
+  /**
+   * Evaluate the gradient of the function at a set of points, by default by calling gradient()
+   * for each point.
+   * \param t The time
+   * \param points The points in space (x,y,z)
+   * \param results The gradients of the function at the points
+   */
+  virtual void gradients(Real t, const std::vector<Point> & points, std::vector<RealGradient> & results);
+
+  /**
+   * Evaluate the time derivative of the function at a set of points, by default by calling
+   * timeDerivative() for each point.
+   * \param t The time
+   * \param points The points in space (x,y,z)
+   * \param results The time derivatives of the function at the points
+   */
+  virtual void timeDerivatives(Real t, const std::vector<Point> & points, std::vector<Real> & results);
+
   // Not defined
   virtual Real integral();
 
@@ -59,13 +59,13 @@ public:
    * @param pt The current point (x,y,z)
    * @return The result of evaluating the function
    */
-  virtual Real value(Real t, const Point & pt) override;
+  virtual Real value(Real t, const Point & pt) override final;
 
   /**
    * Evaluate the gradient of the function. This is computed in libMesh
    * through automatic symbolic differentiation.
    */
-  virtual RealGradient gradient(Real t, const Point & p) override;
+  virtual RealGradient gradient(Real t, const Point & p) override final;
 
   /**
    * Evaluate the time derivative of the function. This is computed in libMesh
@@ -74,7 +74,14 @@ public:
    * \param p The point in space (x,y,z)
    * \return The time derivative of the function at the specified time and location
    */
-  virtual Real timeDerivative(Real t, const Point & p) override;
+  virtual Real timeDerivative(Real t, const Point & p) override final;
+
+  /**
+   * Evaluate the equation, its gradient and its time derivative at a set of points
+   */
+  virtual void values(Real t, const std::vector<Point> & points, std::vector<Real> & results) override;
+  virtual void gradients(Real t, const std::vector<Point> & points, std::vector<RealGradient> & results) override;
+  virtual void timeDerivatives(Real t, const std::vector<Point> & points, std::vector<Real> & results) override;
 
   /**
    * Method invalid for ParsedGradFunction
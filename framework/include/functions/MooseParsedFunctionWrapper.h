@@ -80,6 +80,23 @@ public:
    */
   Real evaluateDot(Real t, const Point & p);
 
+  /**
+   * Evaluate the function at a set of points, the Postprocessor and scalar variable
+   * values are only updated once for all points. fparser evaluates one point per call,
+   * so only functions that do not depend on x, y and z are evaluated once for all points.
+   */
+  void evaluate(Real t, const std::vector<Point> & points, std::vector<Real> & results);
+
+  /**
+   * Evaluate the gradient of the function at a set of points
+   */
+  void evaluateGradient(Real t, const std::vector<Point> & points, std::vector<RealGradient> & results);
+
+  /**
+   * Evaluate the time derivative of the function at a set of points
+   */
+  void evaluateDot(Real t, const std::vector<Point> & points, std::vector<Real> & results);
+
 private:
 
   /// Reference to the FEProblem object
@@ -118,6 +135,9 @@ private:
   /// The thread id passed from owning Function object
   const THREAD_ID _tid;
 
+  /// Whether the function only depends on time (and the user variables), but not on x, y and z
+  bool _space_independent;
+
   /**
    * Initialization method that prepares the vars and vals for use
    * by the libMesh::ParsedFunction object allocated in the constructor
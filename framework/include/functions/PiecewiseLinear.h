@@ -38,7 +38,7 @@ public:
    * \param pt The point in space (x,y,z) (unused)
    * \return The value of the function at the specified time
    */
-  virtual Real value(Real t, const Point & pt) override;
+  virtual Real value(Real t, const Point & pt) override final;
 
   /**
    * Get the time derivative of the function (based on time only)
@@ -46,7 +46,11 @@ public:
    * \param pt The point in space (x,y,z) (unused)
    * \return The time derivative of the function at the specified time
    */
-  virtual Real timeDerivative(Real t, const Point & pt) override;
+  virtual Real timeDerivative(Real t, const Point & pt) override final;
+
+  virtual void values(Real t, const std::vector<Point> & points, std::vector<Real> & results) override;
+
+  virtual void timeDerivatives(Real t, const std::vector<Point> & points, std::vector<Real> & results) override;
 
   virtual Real integral() override;
 
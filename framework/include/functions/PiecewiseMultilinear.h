@@ -49,7 +49,7 @@ public:
 
 private:
 
-  /// object to provide function evaluations at points on the grid
+  /// object to provide function evaluations at points on the grid (shared by all threads)
   MooseSharedPointer<GriddedData> _gridded_data;
   /// dimension of the grid
   unsigned int _dim;
@@ -66,12 +66,25 @@ private:
   /// the grid
   std::vector<std::vector<Real> > _grid;
 
+  /// the function values at the grid points (owned by _gridded_data)
+  const Real * _values;
+
+  /// the distance in _values between neighboring grid points along each axis
+  std::vector<std::size_t> _strides;
+
+  /// Read the data_file (and write it to the write_binary file)
+  MooseSharedPointer<GriddedData> buildGriddedData();
+
   /**
    * This does the core work.  Given a point, pt, defined
    * on the grid (not the MOOSE simulation reference frame),
-   * interpolate the gridded data to this point
+   * interpolate the gridded data to this point.
+   * The grid dimension is a template parameter, so the loops
+   * over the vertices of the hypercube are unrolled and no
+   * memory is allocated.
    */
-  Real sample(const std::vector<Real> & pt);
+  template<unsigned int dim>
+  Real sample(const Real * pt) const;
 
   /**
    * Operates on monotonically increasing in_arr.
@@ -84,7 +97,7 @@ private:
    * @param lower_x Upon return will contain lower_x specified above
    * @param upper_x Upon return will contain upper_x specified above
    */
-  void getNeighborIndices(std::vector<Real> in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x);
+  void getNeighborIndices(const std::vector<Real> & in_arr, Real x, unsigned int & lower_x, unsigned int & upper_x) const;
 };
 
 #endif //PIECEWISEMULTILINEAR_H
@@ -43,7 +43,12 @@ public:
    * @param p Spatial location of desired data
    * @return The value at t and p
    */
-  virtual Real value(Real t, const Point & p) override;
+  virtual Real value(Real t, const Point & p) override final;
+
+  /**
+   * Extract the values at a set of points from the solution
+   */
+  virtual void values(Real t, const std::vector<Point> & points, std::vector<Real> & results) override;
 
   // virtual RealGradient gradient(Real t, const Point & p);
 
@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "MooseTypes.h"
+#include "CompressedSparseMap.h"
 
 // Forward declarations
 class MooseMesh;
@@ -26,7 +27,7 @@ class SlaveNeighborhoodThread
 public:
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          const std::map<dof_id_type, std::vector<dof_id_type> > & node_to_elem_map,
+                          const CompressedSparseMap<dof_id_type> & node_to_elem_map,
                           const unsigned int patch_size);
 
 
@@ -54,7 +55,7 @@ protected:
   const std::vector<dof_id_type> & _trial_master_nodes;
 
   /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type> > & _node_to_elem_map;
+  const CompressedSparseMap<dof_id_type> & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
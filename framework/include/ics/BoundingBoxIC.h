@@ -55,6 +55,8 @@ public:
    */
   virtual Real value(const Point & p);
 
+  virtual bool hasPointwiseValues() const override { return true; }
+
 protected:
   Real _x1;
   Real _y1;
@@ -44,6 +44,8 @@ public:
 
   virtual Real value(const Point & p) override;
 
+  virtual bool hasPointwiseValues() const override { return true; }
+
 protected:
   Real _value;
 };
@@ -36,6 +36,8 @@ class FunctionIC : public InitialCondition
 public:
   FunctionIC(const InputParameters & parameters);
 
+  virtual bool hasPointwiseValues() const override { return true; }
+
 protected:
   /**
    * Evaluate the function at the current quadrature point and timestep.
@@ -47,6 +49,11 @@ protected:
    */
   virtual Real value(const Point &p) override;
 
+  /**
+   * The values of the variable at a set of points.
+   */
+  virtual void values(const std::vector<Point> & points, std::vector<Real> & results) override;
+
   /**
    * The value of the gradient at a point.
    */
@@ -76,6 +76,32 @@ public:
    */
   virtual Real value(const Point & p) = 0;
 
+  /**
+   * The values of the variable at a set of points (the quadrature points of an element, side
+   * or edge in compute()). The default implementation calls value() for each point, derived
+   * classes can override it to evaluate all points in one call.
+   */
+  virtual void values(const std::vector<Point> & points, std::vector<Real> & results);
+
+  /**
+   * Whether value() only depends on the point and the time (and _current_node). Initial
+   * conditions that return true are evaluated once per node for first order Lagrange
+   * variables (see computeNodal()) rather than once for every element sharing the node.
+   * Initial conditions that draw random numbers, use the current element, or couple to
+   * other variables must not return true.
+   */
+  virtual bool hasPointwiseValues() const { return false; }
+
+  /// Whether this initial condition is set node by node with computeNodal() instead of compute()
+  bool computesNodal() const { return _computes_nodal; }
+  void setComputesNodal(bool computes_nodal) { _computes_nodal = computes_nodal; }
+
+  /**
+   * Set the value of a first order Lagrange variable at a node (called by the
+   * ComputeNodalInitialConditionThread if computesNodal() is true)
+   */
+  void computeNodal(const Node & node);
+
   /**
    * The gradient of the variable at a point.
    *
@@ -129,6 +155,12 @@ protected:
 
   std::set<std::string> _depend_vars;
   std::set<std::string> _supplied_vars;
+
+  /// Whether this initial condition is set node by node, see computeNodal()
+  bool _computes_nodal;
+
+  /// The values at the quadrature points in compute()
+  std::vector<Real> _point_values;
 };
 
 #endif //INITIALCONDITION_H
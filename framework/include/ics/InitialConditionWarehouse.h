@@ -37,6 +37,10 @@ public:
    */
   void addObject(MooseSharedPointer<InitialCondition> object, THREAD_ID tid);
 
+  /**
+   * Whether any active initial condition is set node by node (see InitialCondition::computeNodal())
+   */
+  bool hasActiveNodalObjects(THREAD_ID tid = 0) const { return _num_nodal_ics[tid] > 0; }
 
 protected:
 
@@ -45,6 +49,9 @@ protected:
   std::vector<std::map<std::string, std::set<BoundaryID> > > _boundary_ics;
   std::vector<std::map<std::string, std::set<SubdomainID> > > _block_ics;
   ///@}
+
+  /// The number of active initial conditions that are set node by node
+  std::vector<unsigned int> _num_nodal_ics;
 };
 
 #endif /* INITIALCONDITIONWAREHOUSE_H */
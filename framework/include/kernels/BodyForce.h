@@ -40,9 +40,18 @@ public:
 protected:
   virtual Real computeQpResidual() override;
 
+  /// Evaluate the function at all quadrature points of the element at once
+  virtual void precalculateResidual() override;
+
   Real _value;
   Function & _function;
   const PostprocessorValue * const _postprocessor;
+
+  /// The quadrature points of the current element
+  std::vector<Point> _points;
+
+  /// The function values at the quadrature points of the current element
+  std::vector<Real> _function_values;
 };
 
 #endif
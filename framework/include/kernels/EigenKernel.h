@@ -45,6 +45,12 @@ protected:
   virtual Real computeQpResidual() = 0;
   virtual Real computeQpJacobian();
 
+  /**
+   * The factor on the residual and Jacobian, which is the inverse of the eigenvalue
+   * unless the eigen system has a Wielandt shift
+   */
+  Real oneOverEigenvalue() const;
+
   /// Holds the solution at current quadrature points
   const VariableValue & _u;
 
@@ -29,6 +29,7 @@
 #include "Restartable.h"
 #include "ZeroInterface.h"
 #include "MeshChangedInterface.h"
+#include "PerfGraphInterface.h"
 
 class MooseMesh;
 class SubProblem;
@@ -57,7 +58,8 @@ class KernelBase :
   protected GeometricSearchInterface,
   public Restartable,
   public ZeroInterface,
-  public MeshChangedInterface
+  public MeshChangedInterface,
+  public PerfGraphInterface
 {
 public:
   KernelBase(const InputParameters & parameters);
@@ -91,6 +93,22 @@ public:
    */
   virtual void computeNonlocalOffDiagJacobian(unsigned int /* jvar */) {}
 
+  /**
+   * Whether all contributions of this Kernel on the current element are known to vanish, in which
+   * case neither its residual nor any of its Jacobian blocks are computed for the element. Skipping
+   * both keeps the Jacobian consistent with the residual. The variable values at the quadrature
+   * points are available when this is called.
+   */
+  virtual bool skipElement() { return false; }
+
+  /**
+   * Whether the off-diagonal Jacobian block with respect to jvar is known to vanish (or to be
+   * negligible) on the current element, in which case computeOffDiagJacobian(jvar) is not called
+   * for the element. This is only called if skipElement() returned false.
+   * @param jvar The number of the coupled variable
+   */
+  virtual bool skipOffDiagJacobian(unsigned int /* jvar */) { return false; }
+
   /// Returns the variable number that this Kernel operates on.
   MooseVariable & variable();
 
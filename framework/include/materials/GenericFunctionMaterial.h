@@ -41,6 +41,9 @@ protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
 
+  /// Evaluate each function at all quadrature points of the element at once
+  virtual void computeProperties() override;
+
   std::vector<std::string> _prop_names;
   std::vector<FunctionName> _prop_values;
 
@@ -58,6 +61,12 @@ private:
    */
   void computeQpFunctions();
 
+  /// The quadrature points of the current element
+  std::vector<Point> _points;
+
+  /// The values of a function at the quadrature points of the current element
+  std::vector<Real> _values;
+
   /// Flag for calling declareProperyOld/Older
   bool _enable_stateful;
 };
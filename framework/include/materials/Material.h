@@ -34,6 +34,7 @@
 #include "MeshChangedInterface.h"
 #include "OutputInterface.h"
 #include "RandomInterface.h"
+#include "PerfGraphInterface.h"
 #include "MaterialProperty.h"
 
 // forward declarations
@@ -66,7 +67,8 @@ class Material :
     public ZeroInterface,
     public MeshChangedInterface,
     public OutputInterface,
-    public RandomInterface
+    public RandomInterface,
+    public PerfGraphInterface
 {
 public:
 
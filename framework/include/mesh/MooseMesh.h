@@ -20,8 +20,10 @@
 #include "BndElement.h"
 #include "Restartable.h"
 #include "MooseEnum.h"
+#include "CompressedSparseMap.h"
 
 #include <memory> //std::unique_ptr
+#include <mutex>
 
 // libMesh
 #include "libmesh/mesh.h"
@@ -156,13 +158,21 @@ public:
   const std::map<dof_id_type, std::vector<dof_id_type> > & nodeToElemMap();
 
   /**
-   * If not already created, creates a map from every node to all
-   * _active_ _semilocal_ elements to which they are connected.
+   * If not already created, creates a compressed sparse row map from every node
+   * to all elements to which they are connected.  This holds the same information
+   * as nodeToElemMap() in a fraction of the memory and is built with threads, so
+   * it must not be built from inside a threaded loop.
+   */
+  const CompressedSparseMap<dof_id_type> & nodeToElemConnectivity();
+
+  /**
+   * If not already created, creates a compressed sparse row map from every node
+   * to all _active_ _semilocal_ elements to which they are connected.
    * Semilocal elements include local elements and elements that share at least
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type> > & nodeToActiveSemilocalElemMap();
+  const CompressedSparseMap<dof_id_type> & nodeToActiveSemilocalElemConnectivity();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -460,7 +470,7 @@ public:
   /**
    * Return list of blocks to which the given node belongs.
    */
-  const std::set<SubdomainID> & getNodeBlockIds(const Node & node) const;
+  ConstArraySpan<SubdomainID> getNodeBlockIds(const Node & node) const;
 
   /**
    * Return a writable reference to a vector of node IDs that belong
@@ -854,9 +864,16 @@ protected:
   std::map<dof_id_type, std::vector<dof_id_type> > _node_to_elem_map;
   bool _node_to_elem_map_built;
 
-  /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type> > _node_to_active_semilocal_elem_map;
-  bool _node_to_active_semilocal_elem_map_built;
+  /// Compressed storage of the connectivity in _node_to_elem_map
+  CompressedSparseMap<dof_id_type> _node_to_elem_connectivity;
+  bool _node_to_elem_connectivity_built;
+
+  /// A map of all of the current nodes to the active semilocal elements that they are connected to.
+  CompressedSparseMap<dof_id_type> _node_to_active_semilocal_elem_connectivity;
+  bool _node_to_active_semilocal_elem_connectivity_built;
+
+  /// Guards the threaded builds of the compressed connectivity maps (the global spin mutex is too coarse to hold that long)
+  std::mutex _node_to_elem_connectivity_mutex;
 
   /**
    * A set of subdomain IDs currently present in the mesh.
@@ -898,8 +915,8 @@ protected:
   std::map<dof_id_type, std::map<unsigned int, std::map<dof_id_type, Node *> > > _elem_to_side_to_qp_to_quadrature_nodes;
   std::vector<BndNode> _extra_bnd_nodes;
 
-  /// list of nodes that belongs to a specified block (domain)
-  std::map<dof_id_type, std::set<SubdomainID> > _block_node_list;
+  /// list of blocks that each node belongs to (sorted for each node)
+  CompressedSparseMap<SubdomainID> _block_node_list;
 
   /// list of nodes that belongs to a specified nodeset: indexing [nodeset_id] -> [array of node ids]
   std::map<boundary_id_type, std::vector<dof_id_type> > _node_set_nodes;
@@ -913,6 +930,9 @@ protected:
   /// The patch update strategy
   MooseEnum _patch_update_strategy;
 
+  /// The order in which the active local element range is traversed
+  const MooseEnum _element_ordering;
+
   /// file_name iff this mesh was read from a file
   std::string _file_name;
 
@@ -959,6 +979,23 @@ private:
    */
   void detectPairedSidesets();
 
+  /**
+   * Build a compressed node to element map.
+   *
+   * @param range The elements to include
+   * @param active_only Whether to skip inactive elements
+   * @param connectivity The map to fill
+   */
+  void buildNodeToElemConnectivity(const ConstElemRange & range, bool active_only, CompressedSparseMap<dof_id_type> & connectivity);
+
+  /**
+   * Sort elements by subdomain and then along the space filling curve selected by
+   * the "element_ordering" parameter (evaluated at the element centroids).
+   *
+   * @param elems The elements to sort in place
+   */
+  void sortAlongSpaceFillingCurve(std::vector<Elem *> & elems) const;
+
   /**
    * Build the refinement map for a given element type.  This will tell you what quadrature points
    * to copy from and to for stateful material properties on newly created elements from Adaptivity.
@@ -250,8 +250,10 @@ protected:
    *
    * @param i The local app number to create.
    * @param start_time The initial time for the App
+   * @param migrated Whether the App was just migrated from another processor, in which case
+   *                 it recovers from its Backup (see loadBalance())
    */
-  void createApp(unsigned int i, Real start_time);
+  void createApp(unsigned int i, Real start_time, bool migrated = false);
 
   /**
    * Create an MPI communicator suitable for each app.
@@ -260,6 +262,45 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Add to the measured solve cost of a local App.  These costs are used
+   * to redistribute the Apps across processors when "load_balance" is enabled.
+   *
+   * @param local_app The local app number
+   * @param seconds The wall time spent solving the App
+   */
+  void addAppSolveTime(unsigned int local_app, Real seconds);
+
+  /**
+   * Redistribute the Apps across the processors in the original communicator so
+   * that the measured solve cost per processor is as even as possible.  Apps that
+   * change processors are migrated using the Backup / Restore capability.
+   *
+   * This is a collective operation on the original communicator and is only valid
+   * when every processor is working on its own set of Apps (i.e. there are at
+   * least as many Apps as processors).
+   */
+  void loadBalance();
+
+  /**
+   * Contiguously partition Apps across processors based on their cost.
+   *
+   * @param costs The cost of each global App
+   * @param n_procs The number of processors to partition over
+   * @return Offsets of size n_procs+1 where processor p owns Apps [offsets[p], offsets[p+1])
+   */
+  static std::vector<unsigned int> partitionAppsByCost(const std::vector<Real> & costs, unsigned int n_procs);
+
+  /**
+   * Called by loadBalance() after the local Apps have been redistributed but before the
+   * migrated Apps have had their final state restored.  The migrated Apps are recovering,
+   * so they also restore their Backup when they are initialized.  Derived classes should
+   * rebuild any per-App data here.
+   *
+   * @param migrated Whether or not each local App was just migrated to this processor
+   */
+  virtual void appsRedistributed(const std::vector<bool> & migrated);
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -352,6 +393,24 @@ protected:
 
   /// Backups for each local App
   SubAppBackups & _backups;
+
+  /// Whether or not to redistribute Apps based on their measured solve cost
+  bool _load_balance;
+
+  /// The number of time steps between load balancing
+  unsigned int _load_balance_interval;
+
+  /// The imbalance (max processor cost / average processor cost) that will trigger a redistribution
+  Real _load_balance_tolerance;
+
+  /// The accumulated solve time for each local App since the last load balance
+  std::vector<Real> _app_solve_times;
+
+  /// The number of time steps since the last load balance
+  unsigned int _steps_since_load_balance;
+
+  /// The last target time seen in preTransfer() (used to count time steps)
+  Real _last_target_time;
 };
 
 template<>
@@ -53,6 +53,9 @@ public:
    */
   Real computeDT();
 
+protected:
+  virtual void appsRedistributed(const std::vector<bool> & migrated) override;
+
 private:
   /**
    * Setup the executioner for the local app.
@@ -89,6 +89,9 @@ private:
   bool _set_delimiter;
   std::string _delimiter;
 
+  /// Flag for also writing the data to a binary file
+  bool _binary;
+
   /// Flag for writting scalar and/or postprocessor data
   bool _write_all_table;
 
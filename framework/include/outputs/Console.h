@@ -153,6 +153,11 @@ protected:
    */
   void writeVariableNorms();
 
+  /**
+   * Print the hierarchical performance graph
+   */
+  void writePerfGraph();
+
   /// The max number of table rows
   unsigned int _max_rows;
 
@@ -197,6 +202,18 @@ protected:
   /// State for the performance log header information
   bool _perf_header;
 
+  /// State for printing the performance graph at the end of the simulation
+  bool _perf_graph;
+
+  /// The interval at which the performance graph is printed
+  unsigned int _perf_graph_interval;
+
+  /// The maximum depth of the performance graph that is printed
+  unsigned int _perf_graph_max_depth;
+
+  /// Sections of the performance graph below this percentage of the total time are not printed
+  Real _perf_graph_min_percent;
+
   /// Flag for writing all variable norms
   bool _all_variable_norms;
 
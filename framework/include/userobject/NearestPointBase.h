@@ -17,6 +17,7 @@
 
 // MOOSE includes
 #include "ElementIntegralVariableUserObject.h"
+#include "KDTree.h"
 
 // Forward Declarations
 class UserObject;
@@ -79,17 +80,21 @@ protected:
    * @param p The point.
    * @return The UserObject closest to p.
    */
-  std::shared_ptr<UserObjectType> nearestUserObject(const Point & p) const;
+  const std::shared_ptr<UserObjectType> & nearestUserObject(const Point & p) const;
 
   std::vector<Point> _points;
   std::vector<std::shared_ptr<UserObjectType> > _user_objects;
+
+  /// Search tree over _points (it must be rebuilt if the points change)
+  KDTree _kd_tree;
 };
 
 
 template<typename UserObjectType>
 NearestPointBase<UserObjectType>::NearestPointBase(const InputParameters & parameters) :
     ElementIntegralVariableUserObject(parameters),
-    _points(getParam<std::vector<Point> >("points"))
+    _points(getParam<std::vector<Point> >("points")),
+    _kd_tree(_points)
 {
   _user_objects.reserve(_points.size());
 
@@ -144,24 +149,10 @@ NearestPointBase<UserObjectType>::spatialValue(const Point & p) const
 }
 
 template<typename UserObjectType>
-std::shared_ptr<UserObjectType>
+const std::shared_ptr<UserObjectType> &
 NearestPointBase<UserObjectType>::nearestUserObject(const Point & p) const
 {
-  unsigned int closest = 0;
-  Real closest_distance = std::numeric_limits<Real>::max();
-
-  for (unsigned int i = 0; i < _points.size(); i++)
-  {
-    const Point & current_point = _points[i];
-
-    Real current_distance = (p - current_point).norm();
-
-    if (current_distance < closest_distance)
-    {
-      closest_distance = current_distance;
-      closest = i;
-    }
-  }
+  unsigned int closest = _kd_tree.nearest(p);
 
   return _user_objects[closest];
 }
@@ -74,6 +74,15 @@ public:
    */
   virtual Real pointValue(Real t, const Point & p, const unsigned int local_var_index) const;
 
+  /**
+   * Returns the values at a set of locations for a variable (see SolutionFunction)
+   * @param t The time at which to extract (not used, it is handled automatically when reading the data)
+   * @param points The locations at which to return values
+   * @param local_var_index The local index of the variable to be evaluated
+   * @param values The desired values for the given variable at the locations
+   */
+  virtual void pointValues(Real t, const std::vector<Point> & points, const unsigned int local_var_index, std::vector<Real> & values) const;
+
   /**
    * Return a value directly from a Node
    * @param node A pointer to the node at which a value is desired
@@ -157,6 +166,18 @@ protected:
    */
   Real evalMeshFunction(const Point & p, const unsigned int local_var_index, unsigned int func_num) const;
 
+  /**
+   * Evaluate one of the MeshFunctions at a set of points (locking it only once)
+   * @param points The locations at which data is desired
+   * @param local_var_index The local index of the variable to extract data from
+   * @param func_num The MeshFunction index to use (1 = _mesh_function; 2 = _mesh_function2)
+   * @param values The data at the locations
+   */
+  void evalMeshFunction(const std::vector<Point> & points, const unsigned int local_var_index, unsigned int func_num, std::vector<Real> & values) const;
+
+  /// Apply the transformations (in _transformation_order) to a point
+  Point transformPoint(const Point & p) const;
+
   /// File type to read (0 = xda; 1 = ExodusII)
   MooseEnum _file_type;
 
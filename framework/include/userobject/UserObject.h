@@ -23,6 +23,8 @@
 #include "MeshChangedInterface.h"
 #include "ParallelUniqueId.h"
 #include "ScalarCoupleable.h"
+#include "SharedDataInterface.h"
+#include "PerfGraphInterface.h"
 
 // libMesh includes
 #include "libmesh/parallel.h"
@@ -45,7 +47,9 @@ class UserObject :
   public FunctionInterface,
   public Restartable,
   public MeshChangedInterface,
-  public ScalarCoupleable
+  public ScalarCoupleable,
+  public SharedDataInterface,
+  public PerfGraphInterface
 {
 public:
   UserObject(const InputParameters & params);
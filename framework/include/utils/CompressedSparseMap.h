@@ -0,0 +1,488 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDSPARSEMAP_H
+#define COMPRESSEDSPARSEMAP_H
+
+// MOOSE includes
+#include "MooseError.h"
+
+// libMesh includes
+#include "libmesh/id_types.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+/**
+ * A lightweight read-only view of a contiguous array of values.  The view
+ * does not own the data and is invalidated when the owning container changes.
+ */
+template <typename T>
+class ConstArraySpan
+{
+public:
+  typedef const T * const_iterator;
+
+  ConstArraySpan() : _begin(nullptr), _end(nullptr) {}
+  ConstArraySpan(const T * begin, const T * end) : _begin(begin), _end(end) {}
+
+  const_iterator begin() const { return _begin; }
+  const_iterator end() const { return _end; }
+
+  std::size_t size() const { return _end - _begin; }
+  bool empty() const { return _begin == _end; }
+
+  const T & operator[](std::size_t i) const { return _begin[i]; }
+
+  /**
+   * Linear search for a value (the spans stored in a CompressedSparseMap are sorted
+   * but short, so this is typically faster than a binary search).
+   */
+  bool contains(const T & value) const { return std::find(_begin, _end, value) != _end; }
+
+private:
+  const T * _begin;
+  const T * _end;
+};
+
+/**
+ * Compressed sparse row (CSR) storage for a read-only one-to-many map from
+ * dof_id_type keys (typically node ids) to values.  All of the values are
+ * stored in a single contiguous array, with an offset array indexed by
+ * the local key index.
+ *
+ * When the keys are dense (the largest key is less than twice the number of keys,
+ * which is the case for a ReplicatedMesh) the key itself is the index into the
+ * offset array and lookups are O(1).  Otherwise a sorted array of keys is kept and
+ * lookups are done with a binary search.
+ *
+ * Values for new keys can be added after the map is built with insert().  They are kept
+ * in a separate overflow map until the next build() so that spans that have already been
+ * handed out remain valid.
+ */
+template <typename T>
+class CompressedSparseMap
+{
+public:
+  CompressedSparseMap() : _dense(true) {}
+
+  /**
+   * Build the map from the (key, value) pairs produced by a visitor.  The visitor is
+   * called three times as visit_pairs(f) and must call f(key, value) for the same pairs
+   * each time.  Only the keys are stored temporarily, so the peak memory is much lower
+   * than when the pairs are collected and sorted.
+   *
+   * @param visit_pairs The visitor producing the (key, value) pairs
+   * @param unique_values If true, duplicate values for the same key are only stored once
+   */
+  template <typename PairVisitor>
+  void build(const PairVisitor & visit_pairs, bool unique_values = false)
+  {
+    clear();
+
+    // Find the distinct keys
+    std::vector<dof_id_type> keys;
+    KeyCollector key_collector(keys);
+    visit_pairs(key_collector);
+
+    if (!setupKeys(keys))
+      return;
+
+    // Count the values of every key, _offsets[i+1] is the count for key index i
+    Counter counter(*this);
+    visit_pairs(counter);
+
+    mooseAssert(counter._n_values < static_cast<std::size_t>(std::numeric_limits<dof_id_type>::max()), "Too many entries for a CompressedSparseMap");
+
+    for (std::size_t i = 1; i < _offsets.size(); ++i)
+      _offsets[i] += _offsets[i-1];
+
+    // Fill the values using _offsets[i] as the insertion point for key index i, which
+    // leaves _offsets[i] at the beginning of the values of key index i+1
+    _values.resize(_offsets.back());
+    Filler filler(*this);
+    visit_pairs(filler);
+
+    for (std::size_t i = _offsets.size() - 1; i > 0; --i)
+      _offsets[i] = _offsets[i-1];
+    _offsets[0] = 0;
+
+    compress(unique_values);
+  }
+
+  /**
+   * Build the map in parallel from the (key, value) pairs of the items in a range.  The
+   * range is visited three times with Threads::parallel_reduce() and Threads::parallel_for(),
+   * and item_pairs(item, f) must call f(key, value) for the same pairs of an item each time.
+   * The item_pairs functor is called concurrently, so it may only read shared data.
+   *
+   * The values of a key are counted and stored through atomic counters, which is cheaper
+   * than reducing a copy of the offset array for every split of the range.  The order in
+   * which the values are stored does not matter because they are sorted afterwards.
+   *
+   * @param range The items to visit, e.g. a ConstElemRange
+   * @param item_pairs The functor producing the (key, value) pairs of an item
+   * @param unique_values If true, duplicate values for the same key are only stored once
+   */
+  template <typename Range, typename ItemPairs>
+  void buildThreaded(const Range & range, const ItemPairs & item_pairs, bool unique_values = false)
+  {
+    clear();
+
+    // Find the distinct keys
+    ThreadedKeyCollector<Range, ItemPairs> key_collector(item_pairs);
+    Threads::parallel_reduce(range, key_collector);
+
+    if (!setupKeys(key_collector._keys))
+      return;
+
+    // Count the values of every key, counts[i+1] is the count for key index i
+    std::size_t n_offsets = _offsets.size();
+    std::unique_ptr<std::atomic<dof_id_type>[]> counts(new std::atomic<dof_id_type>[n_offsets]);
+    for (std::size_t i = 0; i < n_offsets; ++i)
+      counts[i].store(0, std::memory_order_relaxed);
+
+    Threads::parallel_for(range, ThreadedCounter<Range, ItemPairs>(*this, item_pairs, counts.get()));
+
+    for (std::size_t i = 1; i < n_offsets; ++i)
+      _offsets[i] = _offsets[i-1] + counts[i].load(std::memory_order_relaxed);
+
+    // Fill the values using counts[i] as the insertion point for key index i
+    for (std::size_t i = 0; i < n_offsets; ++i)
+      counts[i].store(_offsets[i], std::memory_order_relaxed);
+
+    _values.resize(_offsets.back());
+    Threads::parallel_for(range, ThreadedFiller<Range, ItemPairs>(*this, item_pairs, counts.get()));
+
+    compress(unique_values);
+  }
+
+  /**
+   * Build the map from a list of (key, value) pairs.
+   *
+   * @param pairs The (key, value) pairs to store
+   * @param unique_values If true, duplicate values for the same key are only stored once
+   */
+  void build(const std::vector<std::pair<dof_id_type, T> > & pairs, bool unique_values = false)
+  {
+    build(PairListVisitor(pairs), unique_values);
+  }
+
+  /**
+   * Add a value for a key that has no values in the compressed storage (for example a
+   * node that was added after the map was built).  The value is kept in a separate
+   * overflow map, so spans into the compressed storage and spans of other keys remain
+   * valid.  Only spans of the same key are invalidated.
+   */
+  void insert(dof_id_type key, const T & value)
+  {
+    std::size_t index;
+    if (findIndex(key, index) && _offsets[index] != _offsets[index+1])
+      mooseError("Values can only be inserted for keys that are not in the compressed storage of a CompressedSparseMap (key " << key << ")");
+
+    _overflow[key].push_back(value);
+  }
+
+  /**
+   * The values associated with a key (an empty span if the key is not present)
+   */
+  ConstArraySpan<T> operator[](dof_id_type key) const
+  {
+    std::size_t index;
+    if (findIndex(key, index) && _offsets[index] != _offsets[index+1])
+      return ConstArraySpan<T>(_values.data() + _offsets[index], _values.data() + _offsets[index+1]);
+
+    if (!_overflow.empty())
+    {
+      typename std::map<dof_id_type, std::vector<T> >::const_iterator it = _overflow.find(key);
+      if (it != _overflow.end())
+        return ConstArraySpan<T>(it->second.data(), it->second.data() + it->second.size());
+    }
+
+    return ConstArraySpan<T>();
+  }
+
+  /**
+   * Whether or not there are any values associated with a key
+   */
+  bool hasKey(dof_id_type key) const
+  {
+    return !(*this)[key].empty();
+  }
+
+  /**
+   * The total number of values stored
+   */
+  std::size_t numValues() const
+  {
+    std::size_t n_values = _values.size();
+    for (const auto & it : _overflow)
+      n_values += it.second.size();
+    return n_values;
+  }
+
+  /**
+   * The approximate memory used by this map (in bytes)
+   */
+  std::size_t memoryUsage() const
+  {
+    std::size_t bytes = _keys.capacity() * sizeof(dof_id_type) + _offsets.capacity() * sizeof(dof_id_type) + _values.capacity() * sizeof(T);
+    for (const auto & it : _overflow)
+      bytes += sizeof(it) + it.second.capacity() * sizeof(T);
+    return bytes;
+  }
+
+  void clear()
+  {
+    _dense = true;
+    std::vector<dof_id_type>().swap(_keys);
+    std::vector<dof_id_type>().swap(_offsets);
+    std::vector<T>().swap(_values);
+    _overflow.clear();
+  }
+
+protected:
+  /**
+   * Sort and unique the keys and size the offset array for them.  Returns false if
+   * there are no keys.  The key list is released.
+   */
+  bool setupKeys(std::vector<dof_id_type> & keys)
+  {
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    if (keys.empty())
+      return false;
+
+    std::size_t n_keys = keys.size();
+    dof_id_type max_key = keys.back();
+    _dense = static_cast<std::size_t>(max_key) < 2 * n_keys;
+
+    if (_dense)
+      _offsets.assign(static_cast<std::size_t>(max_key) + 2, 0);
+    else
+    {
+      _keys.assign(keys.begin(), keys.end());
+      _offsets.assign(n_keys + 1, 0);
+    }
+    std::vector<dof_id_type>().swap(keys);
+
+    return true;
+  }
+
+  /**
+   * Sort the values of every key and, if requested, remove the duplicates
+   */
+  void compress(bool unique_values)
+  {
+    std::size_t n_values = 0;
+    for (std::size_t i = 0; i + 1 < _offsets.size(); ++i)
+    {
+      typename std::vector<T>::iterator begin = _values.begin() + _offsets[i];
+      typename std::vector<T>::iterator end = _values.begin() + _offsets[i+1];
+
+      std::sort(begin, end);
+      if (unique_values)
+        end = std::unique(begin, end);
+
+      _offsets[i] = n_values;
+      n_values = std::copy(begin, end, _values.begin() + n_values) - _values.begin();
+    }
+    _offsets.back() = n_values;
+
+    if (n_values < _values.size())
+    {
+      _values.resize(n_values);
+      _values.shrink_to_fit();
+    }
+  }
+
+  /**
+   * Find the position of a key in the offset array
+   */
+  bool findIndex(dof_id_type key, std::size_t & index) const
+  {
+    if (_dense)
+    {
+      index = key;
+      return index + 1 < _offsets.size();
+    }
+
+    std::vector<dof_id_type>::const_iterator it = std::lower_bound(_keys.begin(), _keys.end(), key);
+    if (it == _keys.end() || *it != key)
+      return false;
+
+    index = it - _keys.begin();
+    return true;
+  }
+
+  /// Collects the keys during build()
+  struct KeyCollector
+  {
+    KeyCollector(std::vector<dof_id_type> & keys) : _keys(keys) {}
+    void operator()(dof_id_type key, const T & /*value*/) { _keys.push_back(key); }
+    std::vector<dof_id_type> & _keys;
+  };
+
+  /// Counts the values of every key during build()
+  struct Counter
+  {
+    Counter(CompressedSparseMap & map) : _map(map), _n_values(0) {}
+    void operator()(dof_id_type key, const T & /*value*/)
+    {
+      std::size_t index;
+      _map.findIndex(key, index);
+      _map._offsets[index + 1]++;
+      _n_values++;
+    }
+    CompressedSparseMap & _map;
+    std::size_t _n_values;
+  };
+
+  /// Stores the values during build()
+  struct Filler
+  {
+    Filler(CompressedSparseMap & map) : _map(map) {}
+    void operator()(dof_id_type key, const T & value)
+    {
+      std::size_t index;
+      _map.findIndex(key, index);
+      _map._values[_map._offsets[index]++] = value;
+    }
+    CompressedSparseMap & _map;
+  };
+
+  /// Collects the keys of a subrange during buildThreaded()
+  template <typename Range, typename ItemPairs>
+  struct ThreadedKeyCollector
+  {
+    ThreadedKeyCollector(const ItemPairs & item_pairs) : _item_pairs(item_pairs) {}
+    ThreadedKeyCollector(ThreadedKeyCollector & x, Threads::split) : _item_pairs(x._item_pairs) {}
+
+    /// Collects the distinct keys of the subrange, so that the sorting is also done in parallel
+    void operator()(const Range & range)
+    {
+      std::vector<dof_id_type> keys;
+      KeyCollector key_collector(keys);
+      for (const auto & item : range)
+        _item_pairs(item, key_collector);
+
+      std::sort(keys.begin(), keys.end());
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+      merge(keys);
+    }
+
+    void join(const ThreadedKeyCollector & y) { merge(y._keys); }
+
+    /// Merges sorted distinct keys into _keys
+    void merge(const std::vector<dof_id_type> & keys)
+    {
+      std::vector<dof_id_type> merged;
+      merged.reserve(_keys.size() + keys.size());
+      std::set_union(_keys.begin(), _keys.end(), keys.begin(), keys.end(), std::back_inserter(merged));
+      _keys.swap(merged);
+    }
+
+    const ItemPairs & _item_pairs;
+    std::vector<dof_id_type> _keys;
+  };
+
+  /// Counts the values of every key in a subrange during buildThreaded()
+  template <typename Range, typename ItemPairs>
+  struct ThreadedCounter
+  {
+    ThreadedCounter(const CompressedSparseMap & map, const ItemPairs & item_pairs, std::atomic<dof_id_type> * counts) :
+        _map(map), _item_pairs(item_pairs), _counts(counts) {}
+
+    void operator()(dof_id_type key, const T & /*value*/) const
+    {
+      std::size_t index;
+      _map.findIndex(key, index);
+      _counts[index + 1].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void operator()(const Range & range) const
+    {
+      for (const auto & item : range)
+        _item_pairs(item, *this);
+    }
+
+    const CompressedSparseMap & _map;
+    const ItemPairs & _item_pairs;
+    std::atomic<dof_id_type> * _counts;
+  };
+
+  /// Stores the values of a subrange during buildThreaded()
+  template <typename Range, typename ItemPairs>
+  struct ThreadedFiller
+  {
+    ThreadedFiller(CompressedSparseMap & map, const ItemPairs & item_pairs, std::atomic<dof_id_type> * cursors) :
+        _map(map), _item_pairs(item_pairs), _cursors(cursors) {}
+
+    void operator()(dof_id_type key, const T & value) const
+    {
+      std::size_t index;
+      _map.findIndex(key, index);
+      _map._values[_cursors[index].fetch_add(1, std::memory_order_relaxed)] = value;
+    }
+
+    void operator()(const Range & range) const
+    {
+      for (const auto & item : range)
+        _item_pairs(item, *this);
+    }
+
+    CompressedSparseMap & _map;
+    const ItemPairs & _item_pairs;
+    std::atomic<dof_id_type> * _cursors;
+  };
+
+  /// Visits the pairs of a list
+  struct PairListVisitor
+  {
+    PairListVisitor(const std::vector<std::pair<dof_id_type, T> > & pairs) : _pairs(pairs) {}
+    template <typename Inserter>
+    void operator()(Inserter & insert) const
+    {
+      for (const auto & pair : _pairs)
+        insert(pair.first, pair.second);
+    }
+    const std::vector<std::pair<dof_id_type, T> > & _pairs;
+  };
+
+  /// Whether the keys are used directly as indices into the offset array
+  bool _dense;
+
+  /// The sorted keys (only used when the keys are not dense)
+  std::vector<dof_id_type> _keys;
+
+  /// The values for key index i are stored in [_offsets[i], _offsets[i+1])
+  std::vector<dof_id_type> _offsets;
+
+  /// All of the values stored contiguously
+  std::vector<T> _values;
+
+  /// Values of keys that were inserted after the map was built
+  std::map<dof_id_type, std::vector<T> > _overflow;
+};
+
+#endif // COMPRESSEDSPARSEMAP_H
@@ -0,0 +1,158 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FIXEDCAPACITYVECTOR_H
+#define FIXEDCAPACITYVECTOR_H
+
+#include "MooseError.h"
+#include "DataIO.h"
+
+/**
+ * A vector with a compile-time maximum size that stores its entries inline.
+ *
+ * It provides the subset of the std::vector interface that is used for
+ * vector-valued material properties (resize, assign, push_back, indexing and
+ * iteration), but never allocates. A MaterialProperty of FixedCapacityVectors
+ * is therefore a single contiguous block of memory, and copying a value between
+ * quadrature points or into the old state is a plain copy.
+ *
+ * Growing beyond the capacity N is an error in all build modes. Indexing is
+ * only checked in debug mode, like std::vector.
+ *
+ * The price is memory: every vector takes the space of N entries whatever its
+ * size, and nested vectors multiply the capacities. Choose N as small as the
+ * application allows.
+ */
+template<typename T, unsigned int N>
+class FixedCapacityVector
+{
+public:
+  typedef T value_type;
+  typedef T * iterator;
+  typedef const T * const_iterator;
+
+  FixedCapacityVector() :
+    _size(0),
+    _data()
+  {
+  }
+
+  /**
+   * @param size The initial size of the vector
+   * @param value The value of all of the entries
+   */
+  explicit
+  FixedCapacityVector(unsigned int size, const T & value = T()) :
+    _size(0),
+    _data()
+  {
+    assign(size, value);
+  }
+
+  /// The number of entries that the vector can hold
+  static unsigned int capacity() { return N; }
+
+  unsigned int size() const { return _size; }
+
+  bool empty() const { return _size == 0; }
+
+  /**
+   * Change the number of entries. Existing entries are kept and new entries
+   * are set to value.
+   */
+  void resize(unsigned int size, const T & value = T())
+  {
+    if (size > N)
+      mooseError("FixedCapacityVector of capacity " << N << " resized to " << size);
+    for (unsigned int i = _size; i < size; ++i)
+      _data[i] = value;
+    _size = size;
+  }
+
+  /// Change the number of entries and set all of them to value
+  void assign(unsigned int size, const T & value)
+  {
+    if (size > N)
+      mooseError("FixedCapacityVector of capacity " << N << " resized to " << size);
+    for (unsigned int i = 0; i < size; ++i)
+      _data[i] = value;
+    _size = size;
+  }
+
+  void push_back(const T & value)
+  {
+    if (_size == N)
+      mooseError("FixedCapacityVector of capacity " << N << " is full");
+    _data[_size++] = value;
+  }
+
+  void clear() { _size = 0; }
+
+  T & operator[](unsigned int i)
+  {
+    mooseAssert(i < _size, "Index " << i << " is out of range of a FixedCapacityVector of size " << _size);
+    return _data[i];
+  }
+
+  const T & operator[](unsigned int i) const
+  {
+    mooseAssert(i < _size, "Index " << i << " is out of range of a FixedCapacityVector of size " << _size);
+    return _data[i];
+  }
+
+  T * data() { return _data; }
+  const T * data() const { return _data; }
+
+  iterator begin() { return _data; }
+  iterator end() { return _data + _size; }
+  const_iterator begin() const { return _data; }
+  const_iterator end() const { return _data + _size; }
+
+private:
+  /// The number of entries in use
+  unsigned int _size;
+
+  /// The entries
+  T _data[N];
+};
+
+template<typename T, unsigned int N>
+inline void
+dataStore(std::ostream & stream, FixedCapacityVector<T, N> & v, void * context)
+{
+  // First store the size of the vector
+  unsigned int size = v.size();
+  stream.write((char *) &size, sizeof(size));
+
+  for (unsigned int i = 0; i < size; i++)
+    storeHelper(stream, v[i], context);
+}
+
+template<typename T, unsigned int N>
+inline void
+dataLoad(std::istream & stream, FixedCapacityVector<T, N> & v, void * context)
+{
+  // First read the size of the vector
+  unsigned int size = 0;
+  stream.read((char *) &size, sizeof(size));
+
+  if (size > N)
+    mooseError("Cannot load " << size << " entries into a FixedCapacityVector of capacity " << N);
+
+  v.resize(size);
+  for (unsigned int i = 0; i < size; i++)
+    loadHelper(stream, v[i], context);
+}
+
+#endif //FIXEDCAPACITYVECTOR_H
@@ -35,6 +35,11 @@ template<> void dataLoad(std::istream & stream, FormattedTable & v, void * conte
 
 /**
  * This class is used for building, formatting, and outputting tables of numbers.
+ *
+ * The data is stored by column: a sorted vector of the times (the rows) and a
+ * vector of values for each column, in which missing values are zero. Rows are
+ * normally appended, and the CSV and binary files are only written from the
+ * first row that changed since the previous output.
  */
 class FormattedTable
 {
@@ -68,9 +73,13 @@ public:
   /**
    * Set whether or not to output time column.
    */
-  void outputTimeColumn(bool output_time) { _output_time = output_time; }
+  void outputTimeColumn(bool output_time);
 
-  const std::map<Real, std::map<std::string, Real> > & getData() const { return _data; }
+  /// The times of the rows of the table
+  const std::vector<Real> & getTimes() const { return _times; }
+
+  /// The values of each column of the table, for each row
+  const std::map<std::string, std::vector<Real> > & getColumns() const { return _columns; }
 
   /**
    * Methods for dumping the table to the stream - either by filename or by stream handle.  If
@@ -87,10 +96,27 @@ public:
   /**
    * Method for dumping the table to a csv file - opening and closing the file handle is handled
    *
+   * New rows are appended and a modified last row is rewritten in place. The whole
+   * file is rewritten if an earlier row is modified or, with align, if the width of
+   * a column changes.
+   *
    * Note: Only call this on processor 0!
    */
   void printCSV(const std::string & file_name, int interval=1, bool align = false);
 
+  /**
+   * Method for dumping the table to a binary file. The file contains
+   *   - the characters "MOOSETBL",
+   *   - the format version and the number of columns (including time) as 32 bit unsigned integers,
+   *   - for each column its name, as the 32 bit unsigned length followed by the characters,
+   *   - for each row the time and the value of each column as doubles.
+   * Numbers are in the native byte order. The rows have a fixed size, so the
+   * file can be read as a two dimensional array.
+   *
+   * Note: Only call this on processor 0!
+   */
+  void printBinary(const std::string & file_name);
+
   void printEnsight(const std::string & file_name);
   void writeExodus(ExodusII_IO * ex_out, Real time);
   void makeGnuplot(const std::string & base_file, const std::string & format);
@@ -100,12 +126,12 @@ public:
   /**
    * By default printCSV places "," between each entry, this allows this to be changed
    */
-  void setDelimiter(std::string delimiter){ _csv_delimiter = delimiter; }
+  void setDelimiter(std::string delimiter);
 
   /**
    * By default printCSV prints output to a precision of 14, this allows this to be changed
    */
-  void setPrecision(unsigned int precision){ _csv_precision = precision; }
+  void setPrecision(unsigned int precision);
 
 
 protected:
@@ -127,12 +153,26 @@ protected:
    */
   unsigned short getTermWidth(bool use_environment) const;
 
-  /**
-   * Data structure for the console table
-   * The first map creates an association from the independent variable (normally time)
-   * to a map of dependent variables and their associated values if they exist
-   */
-  std::map<Real, std::map<std::string, Real> > _data;
+  /// Write the header of the csv file
+  void printCSVHeader(bool align);
+
+  /// Write a row of the csv file
+  void printCSVRow(std::size_t row, bool align);
+
+  /// Set the column widths of an aligned csv file to the widths of the header
+  void initCSVWidths(std::map<std::string, unsigned int> & widths) const;
+
+  /// Widen the column widths of an aligned csv file to fit rows [first_row, end_row)
+  void updateCSVWidths(std::map<std::string, unsigned int> & widths, std::size_t first_row, std::size_t end_row) const;
+
+  /// Mark a row as modified for the csv and binary files
+  void rowModified(std::size_t row);
+
+  /// The times of the rows, in increasing order
+  std::vector<Real> _times;
+
+  /// The values of each column for each row (zero where no data was added)
+  std::map<std::string, std::vector<Real> > _columns;
 
   /// The set of column names updated when data is inserted through the setter methods
   std::set<std::string> _column_names;
@@ -154,6 +194,47 @@ protected:
   /// Whether or not to output the Time column
   bool _output_time;
 
+  /// The number of rows in the csv file
+  std::size_t _csv_rows;
+
+  /// The first row that changed since the csv file was written
+  std::size_t _csv_first_modified_row;
+
+  /// Whether or not the whole csv file has to be rewritten (e.g. when a column is added)
+  bool _csv_rewrite;
+
+  /// The interval and alignment the csv file was written with
+  int _csv_interval;
+  bool _csv_align;
+
+  /// The column widths of an aligned csv file (including "time")
+  std::map<std::string, unsigned int> _csv_widths;
+
+  /// The column widths of the header and all rows but the last one of an aligned csv file
+  std::map<std::string, unsigned int> _csv_kept_widths;
+
+  /// The start of the last row and the end of the rows in the csv file, and the size of the file
+  std::streampos _csv_last_row_pos;
+  std::streampos _csv_end_pos;
+  std::streampos _csv_file_size;
+
+  /// The optional binary output file stream
+  std::string _binary_file_name;
+  std::ofstream _binary_file;
+  bool _binary_stream_open;
+
+  /// The number of rows in the binary file
+  std::size_t _binary_rows;
+
+  /// The first row that changed since the binary file was written
+  std::size_t _binary_first_modified_row;
+
+  /// Whether or not the whole binary file has to be rewritten
+  bool _binary_rewrite;
+
+  /// The start of the rows in the binary file
+  std::streampos _binary_data_pos;
+
 private:
 
   /// *.csv file delimiter, defaults to ","
@@ -42,27 +42,94 @@ protected:
   /// Evaluate FParser object and check EvalError
   Real evaluate(ADFunctionPtr &);
 
+  /**
+   * Evaluate FParser object for nsets parameter sets and check EvalError. The
+   * parameter sets are stored one after the other in _batch_func_params, each with
+   * _func_params.size() entries. Evaluating a function for all sets (e.g. all qps
+   * of an element) before moving on to the next function keeps its byte code or
+   * compiled code in the cache.
+   */
+  void evaluateBatch(ADFunctionPtr &, unsigned int nsets, std::vector<Real> & results);
+
   /// add constants (which can be complex expressions) to the parser object
   void addFParserConstants(ADFunctionPtr & parser,
                            const std::vector<std::string> & constant_names,
                            const std::vector<std::string> & constant_expressions);
 
+  /**
+   * Build the key under which a parsed function is stored in the parser cache. The
+   * key has to identify the parsed function completely, so callers append everything
+   * else that went into the parser object (e.g. derivatives taken) with addToParserKey().
+   */
+  std::string parserKey(const std::string & expression,
+                        const std::string & variables,
+                        const std::vector<std::string> & constant_names,
+                        const std::vector<std::string> & constant_expressions) const;
+
+  /// append a part to a parser cache key
+  static void addToParserKey(std::string & key, const std::string & part);
+
+  /**
+   * Replace parser by a copy of the parser object stored under key, if an identical
+   * function has already been set up in this process (by another object, a thread copy,
+   * or a MultiApp). The copy is a deep copy, so it can be evaluated concurrently with
+   * the other copies, but it shares the JIT compiled code of the cached object.
+   * @return true if the parser was found in the cache
+   */
+  bool fetchCachedParser(const std::string & key, ADFunctionPtr & parser);
+
+  /**
+   * Optimize and JIT compile the parser object (according to the feature flags) and
+   * store a copy of it in the parser cache under key.
+   * @return false if the JIT compilation failed
+   */
+  bool optimizeAndCompile(const std::string & key, ADFunctionPtr & parser);
+
+  /**
+   * JIT compile the parser object, or load its compiled object from the
+   * jit_cache_directory (see jitCompileCached()).
+   * @return false if the JIT compilation failed
+   */
+  bool jitCompile(const std::string & key, ADFunctionPtr & parser);
+
+  /**
+   * JIT compile the parser object in a subdirectory of cache_directory named by a hash
+   * of the parser cache key. The directory is locked while the function is looked up
+   * and compiled, and the key is stored with the name of the compiled object. Ranks and
+   * runs finding a compiled object for their key load it instead of compiling again.
+   * @param loaded set to true if the compiled object was loaded from the cache
+   * @return false if the JIT compilation failed
+   */
+  static bool jitCompileCached(const std::string & cache_directory,
+                               const std::string & key,
+                               ADFunctionPtr & parser,
+                               bool & loaded);
+
   //@{ feature flags
   bool _enable_jit;
   bool _enable_ad_cache;
   bool _disable_fpoptimizer;
   bool _enable_auto_optimize;
   bool _fail_on_evalerror;
+  bool _enable_parser_cache;
   //@}
 
+  /// directory to JIT compile the functions in (empty for the working directory)
+  const std::string _jit_cache_directory;
+
   /// appropriate not a number value to return
   const Real _nan;
 
   /// table of FParser eval error codes
   static const char * _eval_error_msg[];
 
+  friend class FunctionParserUtilsTest;
+
   /// Array to stage the parameters passed to the functions when calling Eval.
   std::vector<Real> _func_params;
+
+  /// Array to stage the parameter sets passed to the functions in evaluateBatch.
+  std::vector<Real> _batch_func_params;
 };
 
 #endif //FUNCTIONPARSERUTILS_H
@@ -18,12 +18,16 @@
 // C++ includes
 #include <vector>
 #include <fstream>
+#include <memory>
 #include <sstream>
 #include <string>
 
 // libMesh includes
 #include "libmesh/libmesh_common.h" // Real
 
+// Forward declarations
+class MappedFile;
+
 /**
  * Container for holding a function defined on a grid of arbitrary dimension.
  *
@@ -35,6 +39,10 @@
  * direction that each grid axis corresponds to.  For instance, the
  * first grid axis might correspond to the MOOSE "y" direction, the
  * second grid axis might correspond to the MOOSE "t" direction, etc.
+ *
+ * The file is either a text file (see parse) or a binary file written by
+ * writeBinary.  Binary files are memory mapped, so the function values
+ * are shared by all processes on a node that read the same file.
  */
 class GriddedData
 {
@@ -44,7 +52,11 @@ public:
    */
   GriddedData(std::string file_name);
 
-  virtual ~GriddedData() = default;
+  virtual ~GriddedData();
+
+  // The function values may point into a mapped file or into this object
+  GriddedData(const GriddedData &) = delete;
+  GriddedData & operator=(const GriddedData &) = delete;
 
   /**
    * Returns the dimensionality of the grid.
@@ -81,6 +93,26 @@ public:
    */
   Real evaluateFcn(const std::vector<unsigned int> & ijk);
 
+  /**
+   * The values defined at the grid points, stored contiguously in the order
+   * described in parse (with the first axis varying fastest).
+   */
+  const Real * getFcnData() const { return _fcn_data; }
+
+  /**
+   * Write the grid and the function values to a binary file.  The file contains
+   *   - the characters "MOOSEGRD",
+   *   - the format version and the dimension as 32 bit unsigned integers,
+   *   - the axis directions as 32 bit integers and the number of grid points
+   *     along each axis as 32 bit unsigned integers,
+   *   - the grid along each axis and the function values as doubles.
+   * Numbers are in the native byte order.
+   */
+  void writeBinary(const std::string & file_name) const;
+
+  /// Whether or not a file is a binary gridded data file
+  static bool isBinary(const std::string & file_name);
+
 private:
   unsigned int _dim;
   std::vector<int> _axes;
@@ -88,6 +120,15 @@ private:
   std::vector<Real> _fcn;
   std::vector<unsigned int> _step;
 
+  /// The function values (_fcn or the values in the mapped file) and their number
+  const Real * _fcn_data;
+  std::size_t _num_fcn;
+
+  /// The mapped binary file
+  std::unique_ptr<MappedFile> _mapped_file;
+
+  void parseBinary(const std::string & file_name);
+
   void parse(unsigned int & dim, std::vector<int> & axes, std::vector<std::vector<Real> > & grid, std::vector<Real> & f, std::vector<unsigned int> & step, std::string file_name);
   bool getSignificantLine(std::ifstream & file_stream, std::string & line);
   void splitToRealVec(const std::string & input_string, std::vector<Real> & output_vec);
@@ -0,0 +1,82 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef KDTREE_H
+#define KDTREE_H
+
+// MOOSE includes
+#include "Moose.h" // using namespace libMesh
+
+// libMesh includes
+#include "libmesh/point.h"
+
+/**
+ * A k-d tree over a fixed set of points for nearest point queries.
+ *
+ * The tree is balanced and stored implicitly: the points are reordered so that
+ * the splitting point of each range of points is in the middle of the range,
+ * and ranges of a few points are searched linearly. Ranges are skipped based on
+ * the distance to the box that contains them, so queries far away from all points
+ * (e.g. above a plane of points) are fast as well. The tree has to be rebuilt with
+ * build() when the points change.
+ */
+class KDTree
+{
+public:
+  KDTree(const std::vector<Point> & points = std::vector<Point>());
+
+  /// Build the tree for a new set of points
+  void build(const std::vector<Point> & points);
+
+  /// The number of points in the tree
+  unsigned int numPoints() const { return _points.size(); }
+
+  /**
+   * Find the point closest to p. If several points are at the same
+   * distance the one with the lowest index is returned.
+   * @param p The point to search for
+   * @return The index of the closest point in the vector the tree was built with
+   */
+  unsigned int nearest(const Point & p) const;
+
+protected:
+  /// Order the points in [begin, end) and store their splitting directions
+  void buildRange(unsigned int begin, unsigned int end);
+
+  /**
+   * Search the points in [begin, end) for a point closer than the current best one
+   * @param offsets The distances from p to the box containing the points in each direction
+   * @param min_distance_sq The squared distance from p to that box
+   */
+  void searchRange(const Point & p, unsigned int begin, unsigned int end, Point & offsets, Real min_distance_sq,
+                   unsigned int & best, Real & best_distance_sq) const;
+
+  /// The largest number of points in a range that is searched linearly
+  static const unsigned int _leaf_size;
+
+  /// The points in tree order
+  std::vector<Point> _points;
+
+  /// The original index of each point in _points
+  std::vector<unsigned int> _indices;
+
+  /// The splitting direction of the range with its middle at each point
+  std::vector<unsigned char> _split_directions;
+
+  /// The bounding box of all points
+  Point _min;
+  Point _max;
+};
+
+#endif // KDTREE_H
@@ -59,6 +59,13 @@ public:
    */
   Real sample(Real x) const;
 
+  /**
+   * Sample the fit for a sequence of nearby abscissae (e.g. at the quadrature points of an
+   * element). The interval of the previous sample is passed in and updated, it is only
+   * looked up (by bisection) if x is not in it anymore.
+   */
+  Real sample(Real x, unsigned int & interval) const;
+
   /**
    * This function will take an independent variable input and will return the derivative of the dependent variable
    * with respect to the independent variable based on the generated fit
@@ -0,0 +1,53 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+// C++ includes
+#include <cstddef>
+#include <string>
+
+/**
+ * A file mapped read-only into memory for as long as the object exists.
+ *
+ * The operating system shares the pages of a mapped file between all processes on a
+ * node that map the same file, so large read-only data (grids, tables, EBSD maps)
+ * stored in a binary file is only held in memory once per node. The mapping makes
+ * no alignment guarantees to the compiler, so values should be copied out of data()
+ * with std::memcpy unless the file layout keeps them aligned.
+ */
+class MappedFile
+{
+public:
+  /// Map a file, errors out if it cannot be opened or mapped
+  MappedFile(const std::string & file_name);
+  ~MappedFile();
+
+  /// The contents of the file (NULL for an empty file)
+  const char * data() const { return _data; }
+
+  /// The size of the file in bytes
+  std::size_t size() const { return _size; }
+
+private:
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  const char * _data;
+  std::size_t _size;
+};
+
+#endif // MAPPEDFILE_H
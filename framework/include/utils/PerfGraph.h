@@ -0,0 +1,204 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef PERFGRAPH_H
+#define PERFGRAPH_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <chrono>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class PerfGraphInterface;
+
+/**
+ * A hierarchical timing graph.
+ *
+ * Timed sections are registered once (by name) and then entered and left through the
+ * integer id returned by registerSection(), usually with a PerfGraph::Guard. Every
+ * thread keeps its own call tree, so the timers can be used inside threaded loops
+ * without locking. Each node of a tree records the number of calls and the total time
+ * spent in that section when it was entered from its parent; the self time of a node is
+ * the total time minus the total time of its children.
+ *
+ * When the graph is disabled (the default) entering a section is a single branch.
+ */
+class PerfGraph
+{
+public:
+  PerfGraph();
+
+  /**
+   * Register a timed section (thread safe). Registering the same name twice returns the same id.
+   * @param name The name of the section that is printed in the graph
+   * @return The id used to enter the section
+   */
+  unsigned int registerSection(const std::string & name);
+
+  /**
+   * Enter a section on the given thread (does nothing when the graph is disabled)
+   * @return true if the section was entered and must be left with pop()
+   */
+  bool push(unsigned int section_id, THREAD_ID tid = 0);
+
+  /**
+   * Leave the section most recently entered on the given thread
+   */
+  void pop(THREAD_ID tid = 0);
+
+  /**
+   * Start recording. This must be called outside of threaded regions.
+   * @param object_timing If true the individual Kernels, Materials and UserObjects are timed too
+   */
+  void enable(bool object_timing = false);
+
+  /**
+   * Stop recording. Sections that are currently entered are still left normally.
+   */
+  void disable() { _enabled = false; }
+
+  /// Whether or not the graph is recording
+  bool enabled() const { return _enabled; }
+
+  /// Whether or not the individual Kernels, Materials and UserObjects are timed
+  bool objectTiming() const { return _enabled && _object_timing; }
+
+  /**
+   * Print the graph as an indented table. Sections that are currently running are
+   * included with their elapsed time, so this may be called at any point of a simulation.
+   * @param os The stream to print to
+   * @param max_depth The maximum depth of the graph to print
+   * @param min_percent Sections taking less than this fraction (in percent) of the total time are not printed
+   */
+  void print(std::ostream & os, unsigned int max_depth = 10, Real min_percent = 0.) const;
+
+  /**
+   * Write the complete graph (for all threads) in JSON format.
+   */
+  void printJSON(std::ostream & os) const;
+
+  /**
+   * A scoped timer: enters a section on construction and leaves it on destruction.
+   */
+  class Guard
+  {
+  public:
+    Guard(PerfGraph & graph, unsigned int section_id, THREAD_ID tid = 0) :
+        _graph(graph),
+        _tid(tid),
+        _active(graph.push(section_id, tid))
+    {
+    }
+
+    ~Guard()
+    {
+      if (_active)
+        _graph.pop(_tid);
+    }
+
+  private:
+    PerfGraph & _graph;
+    const THREAD_ID _tid;
+    const bool _active;
+  };
+
+  /**
+   * A scoped timer for a single Kernel, Material or UserObject that is only active
+   * when object timing is turned on.
+   */
+  class ObjectGuard
+  {
+  public:
+    ObjectGuard(const PerfGraphInterface & object);
+
+    ~ObjectGuard()
+    {
+      if (_active)
+        _graph.pop(_tid);
+    }
+
+  private:
+    PerfGraph & _graph;
+    const THREAD_ID _tid;
+    const bool _active;
+  };
+
+protected:
+  typedef std::chrono::steady_clock Clock;
+
+  /// A node in the call tree of a thread
+  struct Node
+  {
+    Node(unsigned int id) : _id(id), _calls(0), _total(Clock::duration::zero()), _running(false) {}
+
+    /// The total time (in seconds) including the running time if the section is currently entered
+    Real totalTime(const Clock::time_point & now) const;
+
+    unsigned int _id;
+    unsigned long int _calls;
+    Clock::duration _total;
+    Clock::time_point _start;
+    bool _running;
+    std::map<unsigned int, std::unique_ptr<Node> > _children;
+  };
+
+  /// The call tree and the stack of entered sections of a thread
+  struct ThreadData
+  {
+    ThreadData() : _root(libMesh::invalid_uint) { _stack.push_back(&_root); }
+
+    Node _root;
+    std::vector<Node *> _stack;
+  };
+
+  void printNode(std::ostream & os, const Node & node, const Clock::time_point & now, Real total, unsigned int depth, unsigned int max_depth, Real min_percent) const;
+  void printNodeJSON(std::ostream & os, const Node & node, const Clock::time_point & now, unsigned int depth) const;
+
+  /// Whether or not the graph is recording
+  bool _enabled;
+
+  /// Whether or not the individual objects are timed
+  bool _object_timing;
+
+  /// The call trees indexed by thread id
+  std::vector<std::unique_ptr<ThreadData> > _threads;
+
+  /// The names of the sections indexed by section id
+  std::vector<std::string> _section_names;
+
+  /// Map from the section names to the section ids
+  std::map<std::string, unsigned int> _section_ids;
+
+  /// Mutex protecting the section registration
+  Threads::spin_mutex _section_mutex;
+};
+
+namespace Moose
+{
+/**
+ * The hierarchical performance graph (see Console parameters "perf_graph*" and --perf-graph)
+ */
+extern PerfGraph perf_graph;
+}
+
+#endif // PERFGRAPH_H
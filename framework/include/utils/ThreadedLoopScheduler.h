@@ -0,0 +1,261 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef THREADEDLOOPSCHEDULER_H
+#define THREADEDLOOPSCHEDULER_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/threads.h"
+#include "libmesh/stored_range.h"
+
+// C++ includes
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Dynamic, cost weighted scheduling of threaded loops over StoredRanges.
+ *
+ * Threads::parallel_reduce splits a range into pieces with equal numbers of items (static
+ * chunks), so the threads that get the expensive elements (plasticity, contact) finish last.
+ * With dynamic scheduling enabled, the scheduler cuts the range into chunks of about equal cost
+ * instead and runs one body per thread that takes the next chunk from a shared counter until all
+ * chunks are done, so threads that are done early take over the remaining work of the others.
+ *
+ * The cost of an item is estimated from the time the chunks containing it took in the previous
+ * evaluations of the same loop over the same items (the time of a chunk is spread evenly over
+ * its items), so the chunks get finer where the work concentrates. The balance of each loop,
+ * the longest busy time of a thread over the average busy time, is printed with the
+ * performance log.
+ *
+ * The threads themselves are the ones of the libMesh threading backend, so the thread ids
+ * handed out by ParallelUniqueId stay valid. The scheduler itself is not thread safe, loops
+ * must be started from the master thread (as all threaded loops of a problem are).
+ */
+class ThreadedLoopScheduler
+{
+public:
+  /**
+   * @param dynamic Whether to schedule by cost (otherwise loops are passed on to
+   *                Threads::parallel_reduce)
+   */
+  ThreadedLoopScheduler(bool dynamic);
+
+  /**
+   * Whether loops are scheduled by cost
+   */
+  bool dynamic() const { return _dynamic; }
+
+  /**
+   * Run a threaded loop over a range, a replacement for Threads::parallel_reduce(range, body)
+   * @param name The name of the loop that costs and statistics are recorded for
+   * @param range The range of the loop, which must be a StoredRange
+   * @param body The loop body, which must provide a splitting constructor and join()
+   */
+  template<typename RangeType, typename Body>
+  void parallelReduce(const std::string & name, const RangeType & range, Body & body);
+
+  /**
+   * Print the balance of the loops that have been scheduled (nothing if there are none)
+   */
+  void print(std::ostream & os) const;
+
+protected:
+  typedef std::chrono::steady_clock Clock;
+
+  /// The range of the per-thread bodies of a loop
+  typedef StoredRange<std::vector<unsigned int>::const_iterator, unsigned int> SlotRange;
+
+  /// The estimated costs of the items of a range for one loop
+  struct Costs
+  {
+    Costs() : _fingerprint(0), _measured(false) {}
+
+    /// The cost of each item (uniform until the first evaluation has been timed)
+    std::vector<Real> _item_costs;
+
+    /// The hash of the items the costs were measured for
+    std::size_t _fingerprint;
+    bool _measured;
+  };
+
+  /// The balance statistics of a loop
+  struct Statistics
+  {
+    Statistics() : _evaluations(0), _chunks(0), _max_time(0), _mean_time(0) {}
+
+    unsigned long int _evaluations;
+    unsigned long int _chunks;
+
+    /// The summed busy times of the busiest thread and of the average thread
+    Real _max_time;
+    Real _mean_time;
+  };
+
+  /// The chunks of one evaluation of a loop and their timings
+  template<typename RangeType>
+  struct Schedule
+  {
+    Schedule(unsigned int n_chunks, unsigned int n_threads) :
+        _chunks(n_chunks),
+        _next_chunk(0),
+        _chunk_times(n_chunks, 0.),
+        _slot_times(n_threads, 0.)
+    {
+    }
+
+    std::vector<std::unique_ptr<RangeType> > _chunks;
+    std::atomic<unsigned int> _next_chunk;
+    std::vector<Real> _chunk_times;
+    std::vector<Real> _slot_times;
+  };
+
+  /// The body run for each thread, which processes chunks until there are none left
+  template<typename RangeType, typename Body>
+  class Worker
+  {
+  public:
+    Worker(Body & body, Schedule<RangeType> & schedule) :
+        _body(body),
+        _schedule(schedule)
+    {
+    }
+
+    Worker(Worker & x, Threads::split split) :
+        _split_body(new Body(x._body, split)),
+        _body(*_split_body),
+        _schedule(x._schedule)
+    {
+    }
+
+    void operator() (const SlotRange & range)
+    {
+      for (SlotRange::const_iterator slot = range.begin(); slot != range.end(); ++slot)
+      {
+        Clock::duration busy = Clock::duration::zero();
+        for (unsigned int c = _schedule._next_chunk++; c < _schedule._chunks.size(); c = _schedule._next_chunk++)
+        {
+          Clock::time_point start = Clock::now();
+          _body(*_schedule._chunks[c]);
+          Clock::duration elapsed = Clock::now() - start;
+
+          _schedule._chunk_times[c] = std::chrono::duration<Real>(elapsed).count();
+          busy += elapsed;
+        }
+        _schedule._slot_times[*slot] = std::chrono::duration<Real>(busy).count();
+      }
+    }
+
+    void join(const Worker & y) { _body.join(y._body); }
+
+  protected:
+    std::unique_ptr<Body> _split_body;
+    Body & _body;
+    Schedule<RangeType> & _schedule;
+  };
+
+  /**
+   * Hash the items of a range, so that the costs of a range that has been rebuilt (for instance
+   * after the mesh changed) are not reused
+   */
+  template<typename RangeType>
+  static std::size_t fingerprint(const RangeType & range);
+
+  /**
+   * Get the costs of a loop, which are reset if the loop runs over different items than before
+   */
+  Costs & costs(const std::string & name, std::size_t fingerprint, std::size_t size);
+
+  /**
+   * Cut the items into chunks of about equal estimated cost
+   * @param offsets The first item of each chunk followed by the number of items
+   */
+  void buildChunks(const Costs & costs, unsigned int n_threads, std::vector<std::size_t> & offsets) const;
+
+  /**
+   * Update the costs and the statistics of a loop with the times of an evaluation
+   */
+  void record(const std::string & name, Costs & costs, const std::vector<std::size_t> & offsets,
+              const std::vector<Real> & chunk_times, const std::vector<Real> & slot_times);
+
+  /// Whether loops are scheduled by cost
+  const bool _dynamic;
+
+  /// The number of chunks per thread that ranges are cut into
+  const unsigned int _chunks_per_thread;
+
+  /// The costs indexed by loop name
+  std::map<std::string, Costs> _costs;
+
+  /// The statistics indexed by loop name
+  std::map<std::string, Statistics> _statistics;
+
+  // moose_unit needs access
+  friend class ThreadedLoopSchedulerTest;
+};
+
+template<typename RangeType>
+std::size_t
+ThreadedLoopScheduler::fingerprint(const RangeType & range)
+{
+  typedef typename std::decay<decltype(*range.begin())>::type Item;
+  std::hash<Item> hasher;
+
+  std::size_t seed = range.size();
+  for (typename RangeType::const_iterator it = range.begin(); it != range.end(); ++it)
+    seed ^= hasher(*it) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  return seed;
+}
+
+template<typename RangeType, typename Body>
+void
+ThreadedLoopScheduler::parallelReduce(const std::string & name, const RangeType & range, Body & body)
+{
+  const unsigned int n_threads = libMesh::n_threads();
+  if (!_dynamic || n_threads < 2 || range.size() < 2)
+  {
+    Threads::parallel_reduce(range, body);
+    return;
+  }
+
+  Costs & range_costs = costs(name, fingerprint(range), range.size());
+
+  std::vector<std::size_t> offsets;
+  buildChunks(range_costs, n_threads, offsets);
+
+  // the chunks refer to the items stored in the range, so they are cheap to build
+  Schedule<RangeType> schedule(offsets.size() - 1, n_threads);
+  for (unsigned int c = 0; c < schedule._chunks.size(); ++c)
+    schedule._chunks[c].reset(new RangeType(range, range.begin() + offsets[c], range.begin() + offsets[c + 1]));
+
+  std::vector<unsigned int> slots(n_threads);
+  for (unsigned int i = 0; i < n_threads; ++i)
+    slots[i] = i;
+
+  Worker<RangeType, Body> worker(body, schedule);
+  Threads::parallel_reduce(SlotRange(slots.begin(), slots.end(), 1), worker);
+
+  record(name, range_costs, offsets, schedule._chunk_times, schedule._slot_times);
+}
+
+#endif // THREADEDLOOPSCHEDULER_H
@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef LOCATEPOINTSTHREAD_H
+#define LOCATEPOINTSTHREAD_H
+
+#include "MooseTypes.h"
+
+// libMesh includes
+#include "libmesh/mesh_tools.h"
+#include "libmesh/stored_range.h"
+
+// Forward declarations
+class MooseMesh;
+
+/// A range of indices into a vector of points
+typedef StoredRange<std::vector<unsigned int>::const_iterator, unsigned int> PointIndexRange;
+
+/**
+ * Finds the local elements that contain a set of points.
+ *
+ * A point on the boundary between elements is assigned to the element with the
+ * lowest id, so the result does not depend on how the points are split between
+ * the threads.
+ */
+class LocatePointsThread
+{
+public:
+  /**
+   * @param points The points to locate
+   * @param bbox Points outside of this box are skipped without a search
+   * @param pid Only elements owned by this processor are kept
+   */
+  LocatePointsThread(const MooseMesh & mesh, const std::vector<Point> & points, const MeshTools::BoundingBox & bbox, processor_id_type pid);
+
+  // Splitting Constructor
+  LocatePointsThread(LocatePointsThread & x, Threads::split split);
+
+  void operator() (const PointIndexRange & range);
+
+  void join(const LocatePointsThread & y);
+
+  /// The element containing each point that was found and the index of the point
+  std::vector<std::pair<const Elem *, unsigned int> > _located;
+
+protected:
+  const MooseMesh & _mesh;
+  const std::vector<Point> & _points;
+  const MeshTools::BoundingBox & _bbox;
+  processor_id_type _pid;
+};
+
+#endif //LOCATEPOINTSTHREAD_H
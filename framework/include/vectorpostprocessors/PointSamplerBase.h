@@ -26,6 +26,14 @@ class PointSamplerBase;
 template<>
 InputParameters validParams<PointSamplerBase>();
 
+/**
+ * Base class for sampling variables at a set of points.
+ *
+ * The points are located in a single threaded pass and grouped by the local
+ * element that contains them, so each element is reinitialized once for all of
+ * its points. The locations are reused until the mesh changes (unless the
+ * displaced mesh is used).
+ */
 class PointSamplerBase :
   public GeneralVectorPostprocessor,
   public CoupleableMooseVariableDependencyIntermediateInterface,
@@ -40,15 +48,11 @@ public:
   virtual void execute();
   virtual void finalize();
 
+  virtual void meshChanged() override;
+
 protected:
-  /**
-   * Find the local element that contains the point.  This will attempt to use a cached element to speed things up.
-   *
-   * @param p The point in physical space
-   * @param id A unique ID for this point.
-   * @return The Elem containing the point or NULL if this processor doesn't contain an element that contains this point.
-   */
-  const Elem * getLocalElemContainingPoint(const Point & p, unsigned int id);
+  /// Find the local elements containing the points and group the points by element
+  void locatePoints();
 
   /// The Mesh we're using
   MooseMesh & _mesh;
@@ -59,18 +63,30 @@ protected:
   /// The ID to use for each point (yes, this is Real on purpose)
   std::vector<Real> _ids;
 
-  /// Map of _points indices to the values
-  std::map<unsigned int, std::vector<Real> > _values;
+  /// The values of the variables at each point (the values of point i start at i * _coupled_moose_vars.size())
+  std::vector<Real> _values;
 
   /// Whether or not the Point was found on this processor (int because bool and uint don't work with MPI wrappers)
   std::vector<int> _found_points;
 
   unsigned int _qp;
 
-  /// So we don't have to create and destroy this
-  std::vector<Point> _point_vec;
-
   std::unique_ptr<PointLocatorBase> _pl;
+
+  /// The local elements that contain points
+  std::vector<const Elem *> _sample_elems;
+
+  /// The start of the points of each element in _sample_elem_points (with a trailing end)
+  std::vector<unsigned int> _sample_elem_offsets;
+
+  /// The indices of the points in each of the _sample_elems
+  std::vector<unsigned int> _sample_elem_points;
+
+  /// The points the elements were located for
+  std::vector<Point> _located_points;
+
+  /// Whether or not the located elements are up to date with the mesh
+  bool _locations_valid;
 };
 
 #endif
@@ -0,0 +1,61 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SAMPLEPOINTSTHREAD_H
+#define SAMPLEPOINTSTHREAD_H
+
+#include "LocatePointsThread.h"
+
+// Forward declarations
+class SubProblem;
+
+/**
+ * Evaluates variables at points that have been grouped by the element
+ * containing them, reinitializing each element once for all of its points.
+ */
+class SamplePointsThread
+{
+public:
+  /**
+   * @param points All points
+   * @param elems The elements containing points
+   * @param elem_offsets The start of the points of each element in elem_points (with a trailing end)
+   * @param elem_points The indices of the points in each element
+   * @param variable_names The variables to evaluate
+   * @param values The values of the variables for each point (the values of point i start at i * variable_names.size())
+   */
+  SamplePointsThread(SubProblem & subproblem, const std::vector<Point> & points,
+                     const std::vector<const Elem *> & elems, const std::vector<unsigned int> & elem_offsets,
+                     const std::vector<unsigned int> & elem_points, const std::vector<std::string> & variable_names,
+                     std::vector<Real> & values);
+
+  // Splitting Constructor
+  SamplePointsThread(SamplePointsThread & x, Threads::split split);
+
+  /// Evaluate the variables at the points in the elements with the indices in the range
+  void operator() (const PointIndexRange & range);
+
+  void join(const SamplePointsThread & /*y*/) {}
+
+protected:
+  SubProblem & _subproblem;
+  const std::vector<Point> & _points;
+  const std::vector<const Elem *> & _elems;
+  const std::vector<unsigned int> & _elem_offsets;
+  const std::vector<unsigned int> & _elem_points;
+  const std::vector<std::string> & _variable_names;
+  std::vector<Real> & _values;
+};
+
+#endif //SAMPLEPOINTSTHREAD_H
@@ -26,6 +26,7 @@ public:
   virtual ~FluidPropertiesMaterial();
 
 protected:
+  virtual void computeProperties();
   virtual void computeQpProperties();
 
   /// Specific internal energy
@@ -26,6 +26,7 @@ public:
   virtual ~FluidPropertiesMaterialPT();
 
 protected:
+  virtual void computeProperties();
   virtual void computeQpProperties();
 
   /// Pressure (Pa)
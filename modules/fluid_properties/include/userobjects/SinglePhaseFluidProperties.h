@@ -68,6 +68,22 @@ public:
 
   /// Thermal expansion coefficient
   virtual Real beta(Real p, Real T) const = 0;
+
+  /**
+   * Batch versions of the (v, u) properties above, evaluated at n points (typically all
+   * of the quadrature points of an element) in a single call. The input and output
+   * arrays must hold at least n values. The default implementations call the pointwise
+   * methods, so fluids only override these where the work can be vectorized.
+   */
+  ///@{
+  virtual void pressure_batch(unsigned int n, const Real * v, const Real * u, Real * pressure) const;
+  virtual void temperature_batch(unsigned int n, const Real * v, const Real * u, Real * temperature) const;
+  virtual void c_batch(unsigned int n, const Real * v, const Real * u, Real * c) const;
+  virtual void cp_batch(unsigned int n, const Real * v, const Real * u, Real * cp) const;
+  virtual void cv_batch(unsigned int n, const Real * v, const Real * u, Real * cv) const;
+  virtual void mu_batch(unsigned int n, const Real * v, const Real * u, Real * mu) const;
+  virtual void k_batch(unsigned int n, const Real * v, const Real * u, Real * k) const;
+  ///@}
 };
 
 #endif /* SINGLEPHASEFLUIDPROPERTIES_H */
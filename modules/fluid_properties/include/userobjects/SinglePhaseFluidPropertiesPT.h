@@ -58,6 +58,29 @@ public:
   /// Thermal expansion coefficient (-)
   virtual Real beta(Real pressure, Real temperature) const = 0;
 
+  /**
+   * Batch versions of the properties above, evaluated at n points (typically all of the
+   * quadrature points of an element) in a single call. The input and output arrays
+   * must hold at least n values. The default implementations call the pointwise
+   * methods, so fluids only override these where the work at all of the points can
+   * be shared or vectorized.
+   */
+  ///@{
+  virtual void rho_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * rho) const;
+  virtual void rho_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * rho, Real * drho_dp, Real * drho_dT) const;
+  virtual void e_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * e) const;
+  virtual void e_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * e, Real * de_dp, Real * de_dT) const;
+  virtual void c_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * c) const;
+  virtual void cp_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * cp) const;
+  virtual void cv_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * cv) const;
+  virtual void mu_batch(unsigned int n, const Real * density, const Real * temperature, Real * mu) const;
+  virtual void mu_drhoT_batch(unsigned int n, const Real * density, const Real * temperature, Real * mu, Real * dmu_drho, Real * dmu_dT) const;
+  virtual void k_batch(unsigned int n, const Real * density, const Real * temperature, Real * k) const;
+  virtual void s_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * s) const;
+  virtual void h_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * h) const;
+  virtual void h_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * h, Real * dh_dp, Real * dh_dT) const;
+  ///@}
+
 protected:
   /// Universal gas constant (J/mol/K)
   const Real _R;
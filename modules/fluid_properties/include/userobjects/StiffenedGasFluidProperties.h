@@ -52,6 +52,14 @@ public:
   virtual Real h(Real pressure, Real temperature) const;
   virtual void h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const;
 
+  virtual void pressure_batch(unsigned int n, const Real * v, const Real * u, Real * pressure) const;
+  virtual void temperature_batch(unsigned int n, const Real * v, const Real * u, Real * temperature) const;
+  virtual void c_batch(unsigned int n, const Real * v, const Real * u, Real * c) const;
+  virtual void cp_batch(unsigned int n, const Real * v, const Real * u, Real * cp) const;
+  virtual void cv_batch(unsigned int n, const Real * v, const Real * u, Real * cv) const;
+  virtual void mu_batch(unsigned int n, const Real * v, const Real * u, Real * mu) const;
+  virtual void k_batch(unsigned int n, const Real * v, const Real * u, Real * k) const;
+
   virtual Real c2_from_p_rho(Real pressure, Real rho) const;
 
 protected:
@@ -0,0 +1,152 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef TABULATEDFLUIDPROPERTIES_H
+#define TABULATEDFLUIDPROPERTIES_H
+
+#include "SinglePhaseFluidPropertiesPT.h"
+
+class TabulatedFluidProperties;
+
+template<>
+InputParameters validParams<TabulatedFluidProperties>();
+
+/**
+ * Fluid properties interpolated from a table of the properties of another
+ * SinglePhaseFluidPropertiesPT user object on a uniform (pressure, temperature) grid.
+ *
+ * Density, internal energy, enthalpy, entropy, speed of sound and the specific
+ * heat capacities are interpolated with bicubic Hermite polynomials, using the
+ * derivatives at the grid points given by the tabulated fluid where available
+ * and finite difference estimates otherwise. The derivatives wrt pressure and
+ * temperature are the derivatives of the interpolant. Viscosity, thermal
+ * conductivity and the thermal expansion coefficient are not functions of
+ * (pressure, temperature), so they are taken from the tabulated fluid directly,
+ * as are all properties at points outside of the table.
+ *
+ * There is no blending at the edge of the table: a property jumps by the
+ * interpolation error (and its derivatives by the error of the interpolant's
+ * derivatives) where a point leaves the table. The table should therefore cover
+ * the whole range of pressure and temperature of the simulation, with a grid
+ * fine enough that the jump is negligible.
+ *
+ * The table is generated (or read) once by the first processor, broadcast to the
+ * others and shared by all thread copies. It can be saved to a binary file that
+ * is read instead of regenerating the table when the grid, the type of the
+ * tabulated fluid and the values of its parameters match.
+ *
+ * The interpolation is only accurate where the properties are smooth, so the
+ * table should not span a phase boundary of the tabulated fluid.
+ */
+class TabulatedFluidProperties : public SinglePhaseFluidPropertiesPT
+{
+public:
+  TabulatedFluidProperties(const InputParameters & parameters);
+  virtual ~TabulatedFluidProperties();
+
+  virtual Real rho(Real pressure, Real temperature) const override;
+  virtual void rho_dpT(Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT) const override;
+  virtual Real e(Real pressure, Real temperature) const override;
+  virtual void e_dpT(Real pressure, Real temperature, Real & e, Real & de_dp, Real & de_dT) const override;
+  virtual void rho_e_dpT(Real pressure, Real temperature, Real & rho, Real & drho_dp, Real & drho_dT, Real & e, Real & de_dp, Real & de_dT) const override;
+  virtual Real c(Real pressure, Real temperature) const override;
+  virtual Real cp(Real pressure, Real temperature) const override;
+  virtual Real cv(Real pressure, Real temperature) const override;
+  virtual Real mu(Real density, Real temperature) const override;
+  virtual void mu_drhoT(Real density, Real temperature, Real & mu, Real & dmu_drho, Real & dmu_dT) const override;
+  virtual Real k(Real density, Real temperature) const override;
+  virtual Real s(Real pressure, Real temperature) const override;
+  virtual Real h(Real pressure, Real temperature) const override;
+  virtual void h_dpT(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
+  virtual Real beta(Real pressure, Real temperature) const override;
+
+protected:
+  /// The tabulated properties
+  enum PropertyEnum
+  {
+    DENSITY,
+    INTERNAL_ENERGY,
+    ENTHALPY,
+    ENTROPY,
+    SPEED_OF_SOUND,
+    CP,
+    CV,
+    NUM_PROPERTIES
+  };
+
+  /**
+   * The values and the derivatives of the tabulated properties at the grid points,
+   * indexed by property * num_points + i_p * num_T + i_T
+   */
+  struct Table
+  {
+    std::vector<Real> _value;
+    std::vector<Real> _dvalue_dp;
+    std::vector<Real> _dvalue_dT;
+    std::vector<Real> _d2value_dpdT;
+  };
+
+  /**
+   * Build the table, either by reading the file or by evaluating the tabulated fluid
+   */
+  MooseSharedPointer<Table> buildTable() const;
+
+  /**
+   * Evaluate the tabulated fluid at the grid points. The derivatives of density,
+   * internal energy and enthalpy come from the tabulated fluid, the others are
+   * estimated with finite differences.
+   */
+  void generateTable(Table & table) const;
+
+  /**
+   * Read the property values and first derivatives from the binary file
+   * @return false if the file does not exist or was written for a different grid or fluid
+   */
+  bool readTable(Table & table) const;
+
+  /// Write the property values and first derivatives to the binary file
+  void writeTable(const Table & table) const;
+
+  /// Whether or not a point lies in the table (otherwise the tabulated fluid is used)
+  bool inTable(Real pressure, Real temperature) const;
+
+  /**
+   * Interpolate a property and its derivatives at a point inside the table
+   */
+  void interpolate(PropertyEnum property, Real pressure, Real temperature, Real & value, Real & dvalue_dp, Real & dvalue_dT) const;
+
+  /// Interpolate a property at a point inside the table
+  Real interpolate(PropertyEnum property, Real pressure, Real temperature) const;
+
+  /// The fluid that is tabulated
+  const SinglePhaseFluidPropertiesPT & _fp;
+
+  /// The pressure range and number of pressure points of the table
+  const Real _pressure_min;
+  const Real _pressure_max;
+  const unsigned int _num_p;
+
+  /// The temperature range and number of temperature points of the table
+  const Real _temperature_min;
+  const Real _temperature_max;
+  const unsigned int _num_T;
+
+  /// The spacing of the grid
+  const Real _dp;
+  const Real _dT;
+
+  /// The file the table is read from and saved to (empty if the table is not saved)
+  const std::string _file_name;
+
+  /// The type and parameter values of the tabulated fluid, stored with the table in the file
+  const std::string _fluid_description;
+
+  /// The table shared by all thread copies
+  MooseSharedPointer<Table> _table;
+};
+
+#endif /* TABULATEDFLUIDPROPERTIES_H */
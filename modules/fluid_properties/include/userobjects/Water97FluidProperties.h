@@ -229,6 +229,24 @@ public:
    */
   virtual Real beta(Real pressure, Real temperature) const override;
 
+  /**
+   * Batch versions of the (pressure, temperature) properties. These avoid the virtual
+   * call per point, and keep the free energy of every point so that the batches of
+   * the other properties at the same points do not recompute it.
+   */
+  ///@{
+  virtual void rho_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * rho) const override;
+  virtual void rho_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * rho, Real * drho_dp, Real * drho_dT) const override;
+  virtual void e_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * e) const override;
+  virtual void e_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * e, Real * de_dp, Real * de_dT) const override;
+  virtual void c_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * c) const override;
+  virtual void cp_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * cp) const override;
+  virtual void cv_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * cv) const override;
+  virtual void s_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * s) const override;
+  virtual void h_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * h) const override;
+  virtual void h_dpT_batch(unsigned int n, const Real * pressure, const Real * temperature, Real * h, Real * dh_dp, Real * dh_dT) const override;
+  ///@}
+
   /**
    * Saturation pressure as a function of temperature.
    *
@@ -562,7 +580,133 @@ public:
    */
   Real densityRegion3(Real pressure, Real temperature) const;
 
+  /**
+   * A dimensionless free energy and all of its first and second derivatives wrt
+   * the two reduced variables. For the Gibbs free energy of regions 1, 2 and 5
+   * these are (pi, tau), and for the Helmholtz free energy of region 3 they are
+   * (delta, tau).
+   */
+  struct FreeEnergy
+  {
+    Real f;
+    Real df_dx;
+    Real d2f_dx2;
+    Real df_dtau;
+    Real d2f_dtau2;
+    Real d2f_dxtau;
+  };
+
+  /**
+   * Gibbs free energy in Region 1 and all of its first and second derivatives,
+   * evaluated in a single pass over the coefficients
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma1_derivs(Real pi, Real tau, FreeEnergy & gamma) const;
+
+  /**
+   * Gibbs free energy in Region 2 and all of its first and second derivatives,
+   * evaluated in a single pass over the coefficients
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma2_derivs(Real pi, Real tau, FreeEnergy & gamma) const;
+
+  /**
+   * Helmholtz free energy in Region 3 and all of its first and second derivatives,
+   * evaluated in a single pass over the coefficients
+   *
+   * @param delta reduced density (-)
+   * @param tau reduced temperature (-)
+   * @param[out] phi Helmholtz free energy and its derivatives wrt delta and tau (-)
+   */
+  void phi3_derivs(Real delta, Real tau, FreeEnergy & phi) const;
+
+  /**
+   * Gibbs free energy in Region 5 and all of its first and second derivatives,
+   * evaluated in a single pass over the coefficients
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma5_derivs(Real pi, Real tau, FreeEnergy & gamma) const;
+
 protected:
+  /// The free energy of the region that a (p, T) point lies in
+  struct State
+  {
+    /// The object that computed this state
+    const Water97FluidProperties * owner;
+    Real pressure;
+    Real temperature;
+    unsigned int region;
+    /// Reduced pressure pi (regions 1, 2 and 5) or reduced density delta (region 3)
+    Real x;
+    /// Reduced temperature
+    Real tau;
+    /// Density (kg/m^3), only set in region 3
+    Real density;
+    /// Gibbs (regions 1, 2 and 5) or Helmholtz (region 3) free energy and derivatives
+    FreeEnergy g;
+  };
+
+  /**
+   * The region and free energy (with all derivatives) at a (p, T) point.
+   *
+   * The properties are usually requested several times at the same (p, T) point
+   * (rho, e, h and their derivatives from the same material, for example), so the
+   * last state is remembered per thread and reused until the point changes. The
+   * batch methods use one slot per point, so that consecutive batches over the same
+   * points share the states as well.
+   *
+   * @param pressure water pressure (Pa)
+   * @param temperature water temperature (K)
+   * @param slot the memo slot to use
+   * @return the state, valid until the next call on the same thread
+   */
+  const State & state(Real pressure, Real temperature, unsigned int slot = 0) const;
+
+  /// The properties at a state
+  ///@{
+  Real rho(const State & st) const;
+  void rho_dpT(const State & st, Real & rho, Real & drho_dp, Real & drho_dT) const;
+  Real e(const State & st) const;
+  void e_dpT(const State & st, Real & e, Real & de_dp, Real & de_dT) const;
+  Real c(const State & st) const;
+  Real cp(const State & st) const;
+  Real cv(const State & st) const;
+  Real s(const State & st) const;
+  Real h(const State & st) const;
+  void h_dpT(const State & st, Real & h, Real & dh_dp, Real & dh_dT) const;
+  ///@}
+
+  /// The largest number of consecutive integer powers used by the series below
+  static const unsigned int _max_powers = 64;
+
+  /**
+   * Fills powers[k - min_power] = x^k for min_power <= k <= max_power by repeated
+   * multiplication (min_power <= 0 <= max_power)
+   */
+  static void powerLadder(Real x, int min_power, int max_power, Real * powers);
+
+  /**
+   * Evaluates f = sum_i n_i x^I_i y^J_i (for i >= start) and all of its first
+   * and second derivatives in a single pass, using precomputed powers of x and y
+   */
+  static void powerSeries(Real x, Real y, const std::vector<Real> & n, const std::vector<int> & I,
+                          const std::vector<int> & J, unsigned int start, FreeEnergy & f);
+
+  /**
+   * Evaluates f = sum_i n_i y^J_i and its first and second derivatives
+   */
+  static void powerSeries(Real y, const std::vector<Real> & n, const std::vector<int> & J,
+                          Real & f, Real & df_dy, Real & d2f_dy2);
+
   /// Water molar mass (kg/mol)
   const Real _Mh2o;
   /// Specific gas constant for H2O (universal gas constant / molar mass of water - kJ/kg/K)
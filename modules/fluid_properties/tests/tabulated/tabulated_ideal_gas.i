@@ -0,0 +1,46 @@
+# Tabulates an ideal gas and saves the table to a file. Used to check that a saved
+# table is only read for a fluid with the same parameter values
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Variables]
+  [./dummy]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = dummy
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 8.31
+    [../]
+    [./tabulated]
+      type = TabulatedFluidProperties
+      fp = ideal_gas
+      pressure_min = 1e5
+      pressure_max = 1e6
+      num_p = 10
+      temperature_min = 300
+      temperature_max = 400
+      num_T = 10
+      file_name = ideal_gas_table.bin
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -11,7 +11,7 @@
 
 /**
  * Action that sets up ACGrGrPoly, ACInterface, TimeDerivative, and ACGBPoly
- * kernels.
+ * kernels, and the SumEtaSquaredMaterial shared by the ACGrGrPoly kernels.
  */
 class PolycrystalKernelAction: public Action
 {
@@ -29,6 +29,9 @@ protected:
 
   /// kernels are implicit?
   bool _implicit;
+
+  /// name of the material (and property) holding the sum of the squared order parameters
+  const MaterialPropertyName _sum_eta_squared_name;
 };
 
 template<>
@@ -11,7 +11,8 @@
 
 /**
  * Action that sets up ACSEDGPoly Kernels that add the stored energy contribution to grain growth models
- * This allows such models to simulate recrystallization as well.
+ * This allows such models to simulate recrystallization as well. The kernels share the
+ * SumEtaSquaredMaterial of the PolycrystalKernel action (added here if it does not exist yet).
  */
 class PolycrystalStoredEnergyAction: public Action
 {
@@ -29,6 +30,9 @@ protected:
 
   /// number of deformed grains
   unsigned int _deformed_grain_num;
+
+  /// name of the SumEtaSquaredMaterial and its material property
+  const MaterialPropertyName _sum_eta_squared_name;
 };
 
 template<>
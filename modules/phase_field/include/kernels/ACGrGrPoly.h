@@ -29,16 +29,42 @@ protected:
   virtual Real computeDFDOP(PFFunctionType type);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  virtual bool skipElement();
+  virtual bool skipOffDiagJacobian(unsigned int jvar);
+
+  /**
+   * Whether the magnitude of a variable is below the sparsity threshold at all quadrature points
+   * of the current element and at all degrees of freedom of its face neighbors. This checks the
+   * current solution rather than the op to grain map of a GrainTracker: that map is only updated
+   * when the tracker executes (usually once per time step) and marks an order parameter as
+   * present above the tracker's connecting threshold, which is far too coarse for the terms
+   * skipped here, and not every grain growth model has a tracker.
+   */
+  bool isBelowThreshold(const MooseVariable & var, const VariableValue & value);
+
+  /// Whether the magnitude of all degrees of freedom of a variable on a node or element is below the sparsity threshold
+  bool isBelowThreshold(const MooseVariable & var, const DofObject & dof_object) const;
+
   const unsigned int _op_num;
 
   std::vector<const VariableValue *> _vals;
   std::vector<unsigned int> _vals_var;
+  std::vector<MooseVariable *> _vals_moose_var;
+
+  /// Index into _vals for a given variable number (libMesh::invalid_uint if not coupled)
+  std::vector<unsigned int> _vals_index;
 
   const MaterialProperty<Real> & _mu;
   const MaterialProperty<Real> & _gamma;
   const MaterialProperty<Real> & _tgrad_corr_mult;
 
   const VariableGradient * _grad_T;
+
+  /// Optional precomputed sum of the squares of all order parameters
+  const MaterialProperty<Real> * _sum_eta_squared;
+
+  /// Order parameters below this value on an element are treated as zero (0 disables this)
+  const Real _sparsity_threshold;
 };
 
 #endif //ACGRGRPOLY_H
@@ -52,6 +52,9 @@ protected:
 
   /// index of the OP the kernel is currently acting on
   unsigned int _op_index;
+
+  /// Optional precomputed sum of the squares of all order parameters
+  const MaterialProperty<Real> * _sum_eta_squared;
 };
 
 #endif //ACSEDGPOLY_H
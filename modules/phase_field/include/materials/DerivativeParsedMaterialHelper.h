@@ -11,6 +11,8 @@
 #include "ParsedMaterialHelper.h"
 #include "libmesh/fparser_ad.hh"
 
+#include <deque>
+
 // Forward Declarations
 class DerivativeParsedMaterialHelper;
 
@@ -30,11 +32,19 @@ protected:
   virtual void computeProperties();
 
   virtual void functionsPostParse();
+  void hoistSubexpressions();
   void assembleDerivatives();
   MatPropDescriptorList::iterator findMatPropDerivative(const FunctionMaterialPropertyDescriptor &);
 
   struct QueueItem;
   struct Derivative;
+  struct Subexpression;
+
+  /// add a variable to all parser objects that get further derivatives taken and return its parameter slot
+  unsigned int addDerivativeVariable(std::deque<QueueItem> & queue, const std::string & name);
+
+  /// register the derivative d(symbol)/d(var) = newvarname in all parser objects that get further derivatives taken
+  void registerDerivative(std::deque<QueueItem> & queue, const std::string & symbol, const std::string & var, const std::string & newvarname);
 
   /// The requested derivatives of the free energy
   std::vector<Derivative> _derivatives;
@@ -45,8 +55,27 @@ protected:
   /// next available variable number for automatically created material property derivative variables
   unsigned int _dmatvar_index;
 
+  /// parameter buffer slots of the entries in _mat_prop_descriptors
+  std::vector<unsigned int> _mat_prop_slots;
+
+  /**
+   * Subexpressions occurring more than once in the function expression, and their derivatives.
+   * They are evaluated once per qp (in the order of this list) and passed as parameters into
+   * the function and its derivatives.
+   */
+  std::vector<Subexpression> _subexpressions;
+
+  /// variable base name for the hoisted subexpressions and their derivatives
+  const std::string _subexpression_base;
+
+  /// next available variable number for hoisted subexpressions and their derivatives
+  unsigned int _subexpression_index;
+
   /// maximum derivative order
   unsigned int _derivative_order;
+
+  /// results of the batched evaluation of a function for all qps of an element
+  std::vector<Real> _batch_results;
 };
 
 struct DerivativeParsedMaterialHelper::QueueItem
@@ -59,6 +88,27 @@ struct DerivativeParsedMaterialHelper::QueueItem
   std::vector<unsigned int> _dargs;
 };
 
+struct DerivativeParsedMaterialHelper::Subexpression
+{
+  /// fparser variable name the subexpression is passed in as
+  std::string _symbol;
+
+  /// parser object evaluating the subexpression
+  ADFunctionPtr _F;
+
+  /// index of the hoisted subexpression this one is a derivative of (in _subexpressions)
+  unsigned int _base;
+
+  /// sorted indices of the variables the derivative is taken w.r.t.
+  std::vector<unsigned int> _dargs;
+
+  /// slot of the subexpression in the parameter buffer
+  unsigned int _slot;
+
+  /// flags indicating for which variables the derivative has been taken (and registered) already
+  std::vector<bool> _derived;
+};
+
 struct DerivativeParsedMaterialHelper::Derivative
 {
   MaterialProperty<Real> * first;
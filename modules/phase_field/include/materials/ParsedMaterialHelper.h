@@ -58,6 +58,13 @@ protected:
   /// The undiffed free energy function parser object.
   ADFunctionPtr _func_F;
 
+  /// expression and comma separated fparser variable list the undiffed function was parsed from
+  std::string _func_expression;
+  std::string _func_variables;
+
+  /// Key of the parsed function in the parser cache
+  std::string _func_key;
+
   /// variable names used in the expression (depends on the map_mode)
   std::vector<std::string> _variable_names;
 
@@ -0,0 +1,48 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef SUMETASQUAREDMATERIAL_H
+#define SUMETASQUAREDMATERIAL_H
+
+#include "Material.h"
+#include "DerivativeMaterialInterface.h"
+
+// Forward Declarations
+class SumEtaSquaredMaterial;
+
+template<>
+InputParameters validParams<SumEtaSquaredMaterial>();
+
+/**
+ * Computes the sum of the squares of a set of order parameters
+ * \f$ \sum_i \eta_i^2 \f$ and its derivatives \f$ 2\eta_i \f$ once per
+ * quadrature point, so that the polycrystal Allen-Cahn kernels for each
+ * of the order parameters do not have to recompute it for every test
+ * and shape function.
+ */
+class SumEtaSquaredMaterial : public DerivativeMaterialInterface<Material>
+{
+public:
+  SumEtaSquaredMaterial(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties();
+
+  /// Number of order parameters
+  const unsigned int _op_num;
+
+  /// Order parameter values
+  std::vector<const VariableValue *> _vals;
+
+  /// Material property to store \f$ \sum_i \eta_i^2 \f$
+  MaterialProperty<Real> & _sum;
+
+  /// Material properties to store the derivatives \f$ 2\eta_i \f$
+  std::vector<MaterialProperty<Real> *> _dsum;
+};
+
+#endif //SUMETASQUAREDMATERIAL_H
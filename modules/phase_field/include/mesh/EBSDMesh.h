@@ -41,9 +41,12 @@ public:
   const std::string & getEBSDFilename() const { return _filename; }
 
 protected:
-  /// Read the EBSD data file header
+  /// Read the EBSD data file header (from a text or a binary EBSD file)
   void readEBSDHeader();
 
+  /// Read the grid geometry from the comment lines of a text EBSD file
+  void readEBSDTextHeader();
+
   /// Name of the file containing the EBSD data
   std::string _filename;
 
@@ -185,6 +185,16 @@ public:
     // TODO: Doco
     void clear();
 
+    /**
+     * Sorts the id vectors and removes duplicate entries. Ids may be appended to the
+     * id vectors in any order while a feature is being built, but this method must
+     * be called before any of the set operations are used.
+     */
+    void consolidateIds();
+
+    /// Sorts a vector of ids and removes the duplicate entries
+    static void sortAndUnique(std::vector<dof_id_type> & ids);
+
     /// Comparison operator for sorting individual FeatureDatas
     bool operator<(const FeatureData & rhs) const
     {
@@ -203,17 +213,23 @@ public:
     /// stream output operator
     friend std::ostream & operator<< (std::ostream & out, const FeatureData & feature);
 
+    ///@{
+    /**
+     * The id containers are sorted vectors of unique ids (see consolidateIds()), which are much
+     * more compact than std::sets and can be used directly with the std:: set algorithms.
+     */
     /// Holds the ghosted ids for a feature (the ids which will be used for stitching
-    std::set<dof_id_type> _ghosted_ids;
+    std::vector<dof_id_type> _ghosted_ids;
 
     /// Holds the local ids in the interior of a feature. This data structure is only maintained on the local processor
-    std::set<dof_id_type> _local_ids;
+    std::vector<dof_id_type> _local_ids;
 
     /// Holds the ids surrounding the feature
-    std::set<dof_id_type> _halo_ids;
+    std::vector<dof_id_type> _halo_ids;
 
     /// Holds the nodes that belong to the feature on a periodic boundary
-    std::set<dof_id_type> _periodic_nodes;
+    std::vector<dof_id_type> _periodic_nodes;
+    ///@}
 
     /// The Moose variable where this feature was found (often the "order parameter")
     unsigned int _var_idx;
@@ -257,11 +273,18 @@ protected:
   /**
    * This method will "mark" all entities on neighboring elements that
    * are above the supplied threshold. If feature is NULL, we are exploring
-   * for a new region to mark, otherwise we are in the recursive calls
-   * currently marking a region.
+   * for a new region to mark, otherwise the entities are added to the supplied feature.
+   * The flood is done iteratively (using the _entity_stack) so the depth of the
+   * search is not limited by the size of the call stack.
    */
   void flood(const DofObject * dof_object, unsigned long current_idx, FeatureData * feature);
 
+  /**
+   * Adds a single entity that passed the threshold test to a feature and queues
+   * its neighbors (helper for flood).
+   */
+  void floodEntity(const DofObject * dof_object, unsigned long current_idx, FeatureData * feature);
+
   /**
    * Return a comparison threshold to use when inspecting an entity during the flood
    * stage.
@@ -278,6 +301,7 @@ protected:
   /**
    * These two routines are utility routines used by the flood routine and by derived classes for visiting neighbors.
    * Since the logic is different for the elemental versus nodal case it's easier to split them up.
+   * Unless expand_halos_only is true, the neighbors that need to be flooded are pushed onto the _entity_stack.
    */
   void visitNodalNeighbors(const Node * node, unsigned long current_idx, FeatureData * feature, bool expand_halos_only);
   void visitElementalNeighbors(const Elem * elem, unsigned long current_idx, FeatureData * feature, bool expand_halos_only);
@@ -464,9 +488,13 @@ protected:
   /**
    * This variable keeps track of which nodes have been visited during execution.  We don't use the _feature_map
    * for this since we don't want to explicitly store data for all the unmarked nodes in a serialized datastructures.
-   * This keeps our overhead down since this variable never needs to be communicated.
+   * This keeps our overhead down since this variable never needs to be communicated. There is one flat bitset
+   * per variable, indexed by the entity id.
    */
-  std::vector<std::map<dof_id_type, bool> > _entities_visited;
+  std::vector<std::vector<bool> > _entities_visited;
+
+  /// The entities that still need to be inspected by the current flood
+  std::vector<const DofObject *> _entity_stack;
 
   /**
    * This map keeps track of which variables own which nodes.  We need a vector of them for multimap mode where
@@ -11,6 +11,7 @@
 #include "EBSDAccessFunctors.h"
 
 class EBSDReader;
+class EBSDBinaryFile;
 
 template<>
 InputParameters validParams<EBSDReader>();
@@ -29,6 +30,13 @@ InputParameters validParams<EBSDReader>();
  *
  * Phases are referred to using the numbers in the EBSD data file. In case the phase number in the data file
  * starts at 1 the phase 0 will simply contain no grains.
+ *
+ * The data is read from a text file or a (memory mapped) binary file written by this
+ * object. Text files are parsed into a copy of the point data on every processor. The
+ * point data of a binary file is read from the mapping on demand, so all processes on
+ * a node share a single copy in the page cache. Optionally only the point data around
+ * the local elements is copied on each processor instead. The grain averages are
+ * always computed from all points.
  */
 class EBSDReader : public EulerAngleProvider, public EBSDAccessFunctors
 {
@@ -43,10 +51,17 @@ public:
   virtual void finalize() {}
 
   /**
-   * Get the requested type of data at the point p.
+   * Get the requested type of data at the point p. For a mapped binary file the
+   * returned reference is only valid until the next call on this (per thread) object.
    */
   const EBSDPointData & getData(const Point & p) const;
 
+  /**
+   * Whether the point data at p is available on this processor, which is only
+   * not the case outside of the local subvolume
+   */
+  bool hasData(const Point & p) const;
+
   /**
    * Get the requested type of average data for (global) grain number i.
    */
@@ -123,8 +138,41 @@ protected:
   /// number of additional custom data columns
   unsigned int _custom_columns;
 
-  /// Logically three-dimensional data indexed by geometric points in a 1D vector
-  std::vector<EBSDPointData> _data;
+  /// Whether to only store the point data in the neighborhood of the local elements
+  const bool _local_subvolume;
+
+  /// The point data read from the EBSD file (shared by all thread copies of this object)
+  struct EBSDPointDataSet
+  {
+    /**
+     * Logically three-dimensional data indexed by geometric points in a 1D vector.
+     * It covers the grid cells _offset to _offset + _size - 1 in each direction.
+     */
+    std::vector<EBSDPointData> _points;
+
+    /// The mapped binary file the points are read from instead of _points (if set)
+    MooseSharedPointer<EBSDBinaryFile> _file;
+
+    ///@{ The part of the EBSD grid covered by the point data (all of it unless local_subvolume is set)
+    unsigned int _offset[3];
+    unsigned int _size[3];
+    bool _partial;
+    ///@}
+
+    /// Feature ids in the order of their first appearance in the file
+    std::vector<unsigned int> _feature_ids;
+
+    ///@{ Sums of the data of all points of each feature, in the order of _feature_ids
+    std::vector<EBSDAvgData> _sums;
+    std::vector<EulerAngles> _angle_sums;
+    ///@}
+  };
+
+  /// Logically three-dimensional data indexed by geometric points
+  MooseSharedPointer<EBSDPointDataSet> _data;
+
+  /// The last point read from a mapped binary file by getData
+  mutable EBSDPointData _mapped_point;
 
   /// Averages by (global) grain ID
   std::vector<EBSDAvgData> _avg_data;
@@ -165,11 +213,38 @@ protected:
   /// Computes a global index in the _data array given an input *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
+  /// Computes the index of the point data at the point p in a data set
+  unsigned indexFromPoint(const Point & p, const EBSDPointDataSet & data) const;
+
+  /// Computes the grid indices of the point p relative to the part of the grid covered by a data set
+  void gridIndices(const Point & p, const EBSDPointDataSet & data, unsigned int index[3]) const;
+
   /// Transfer the index into the _avg_data array from given index
   unsigned indexFromIndex(unsigned int var) const;
 
   /// Build grain and phase weight maps
   void buildNodeWeightMaps();
+
+  /**
+   * Read the point data from a text or binary EBSD file, keeping the points in the
+   * given part of the grid
+   */
+  MooseSharedPointer<EBSDPointDataSet> readPointData(const std::string & filename, unsigned int dim, const unsigned int offset[3], const unsigned int size[3]) const;
+
+  /// Read the point data of the whole grid from a text EBSD file
+  void readTextPointData(const std::string & filename, unsigned int dim, EBSDPointDataSet & data) const;
+
+  /// Read the point data from a binary EBSD file, keeping the file mapped unless only a subvolume is stored
+  void readBinaryPointData(const std::string & filename, EBSDPointDataSet & data) const;
+
+  /// Size and clear the sums of the point data, and map the feature ids to their index in the sums
+  void initSums(EBSDPointDataSet & data, std::map<unsigned int, unsigned int> & feature_index) const;
+
+  /// Add a point to the sums of its feature
+  void addToSums(EBSDPointDataSet & data, const std::map<unsigned int, unsigned int> & feature_index, const EBSDPointData & d) const;
+
+  /// Determine the part of the EBSD grid that the centroids of the local elements and their ghosted point neighbors lie in
+  void localSubvolume(unsigned int offset[3], unsigned int size[3]) const;
 };
 
 #endif // EBSDREADER_H
@@ -0,0 +1,114 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+#ifndef EBSDBINARYFILE_H
+#define EBSDBINARYFILE_H
+
+#include "EBSDAccessFunctors.h"
+#include "EBSDMesh.h"
+
+#include <cstdint>
+#include <memory>
+
+// Forward declarations
+class MappedFile;
+
+/**
+ * Binary EBSD data file that is memory mapped for reading.
+ *
+ * The file consists of a Header, one record for each point of the EBSD grid in
+ * [z][y][x] order, and the list of feature ids in the order of their first
+ * appearance in the original text file (which determines the global grain ids).
+ * A record holds the Euler angles (in degrees), the point coordinates, the
+ * feature id, phase and symmetry, followed by the custom data columns.
+ *
+ * The file is mapped read-only, so the operating system shares its pages between
+ * all processes on a node that read the same file. Binary files are written by
+ * the EBSDReader from the data of a text file (see its write_binary parameter).
+ */
+class EBSDBinaryFile
+{
+public:
+  /// Open and map a binary EBSD file
+  EBSDBinaryFile(const std::string & filename);
+  ~EBSDBinaryFile();
+
+  /// Whether the file is a binary EBSD file (rather than a text file)
+  static bool isBinary(const std::string & filename);
+
+  /// Read the grid geometry from the header of a binary EBSD file
+  static void readGeometry(const std::string & filename, EBSDMesh::EBSDMeshGeometry & geometry);
+
+  /**
+   * Write a binary EBSD file
+   * @param points The point data of the whole grid in [z][y][x] order
+   * @param feature_ids The feature ids in the order of their first appearance
+   */
+  static void write(const std::string & filename, const EBSDMesh::EBSDMeshGeometry & geometry, unsigned int num_custom,
+                    const std::vector<EBSDAccessFunctors::EBSDPointData> & points, const std::vector<unsigned int> & feature_ids);
+
+  /// The number of custom data columns in the file
+  unsigned int numCustomColumns() const { return _header._num_custom; }
+
+  /// The number of points in the file
+  std::size_t numPoints() const { return _num_points; }
+
+  /**
+   * Get the data of point i, including the first num_custom custom data columns
+   */
+  void getPoint(std::size_t i, EBSDAccessFunctors::EBSDPointData & d, unsigned int num_custom) const;
+
+  /// The feature ids in the order of their first appearance
+  std::vector<unsigned int> getFeatureIDs() const;
+
+protected:
+  struct Header
+  {
+    char _magic[8];
+    uint32_t _version;
+    uint32_t _dim;
+    uint32_t _n[3];
+    uint32_t _num_custom;
+    uint64_t _num_features;
+    double _d[3];
+    double _min[3];
+  };
+
+  struct Record
+  {
+    double _phi1;
+    double _Phi;
+    double _phi2;
+    double _p[3];
+    uint32_t _feature_id;
+    uint32_t _phase;
+    uint32_t _symmetry;
+    uint32_t _padding;
+  };
+
+  /// Read the header of a file and check that it is a binary EBSD file
+  static bool readHeader(const std::string & filename, Header & header);
+
+  /// The number of points on the grid of a header
+  static std::size_t numPoints(const Header & header);
+
+  /// The size of a point record including the custom data columns
+  static std::size_t recordSize(const Header & header) { return sizeof(Record) + header._num_custom * sizeof(double); }
+
+  const std::string _filename;
+
+  Header _header;
+  std::size_t _num_points;
+
+  /// The mapped file
+  std::unique_ptr<MappedFile> _mapped_file;
+
+  /// Start of the point records and the feature ids in the mapped file
+  const char * _records;
+  const char * _feature_ids;
+};
+
+#endif // EBSDBINARYFILE_H
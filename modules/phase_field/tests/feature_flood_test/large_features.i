@@ -0,0 +1,63 @@
+###########################################################
+# FeatureFloodCount on features that span a large number of
+# entities.  The default variable is a single serpentine
+# feature made of horizontal stripes that are connected at
+# alternating ends, so flooding it follows a path through
+# every node of the feature.  This overflowed the stack when
+# the flood was recursive.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 400
+  ny = 400
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Functions]
+  # Even stripes are part of the feature; odd stripes only connect
+  # the neighboring even stripes at one end
+  [./snake]
+    type = ParsedFunction
+    value = 'if(floor(20*y)%2=0, 1, if(floor((floor(20*y)-1)/2)%2=0, if(x>0.95,1,0), if(x<0.05,1,0)))'
+  [../]
+  # Two halves separated by a gap
+  [./halves]
+    type = ParsedFunction
+    value = 'if(abs(x-0.5)<0.02, 0, 1)'
+  [../]
+[]
+
+[ICs]
+  [./u_ic]
+    type = FunctionIC
+    function = snake
+    variable = u
+  [../]
+[]
+
+[Postprocessors]
+  [./flood_count_pp]
+    type = FeatureFloodCount
+    variable = u
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Problem]
+  type = FEProblem
+  solve = false
+[]
+
+[Executioner]
+  type = Steady
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -31,22 +31,22 @@ protected:
 
 private:
   /// Pressure of each phase (at the qps)
-  const MaterialProperty<std::vector<Real> > * _pressure;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _pressure;
 
   /// Saturation of each phase (at the qps)
-  const MaterialProperty<std::vector<Real> > * _saturation;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _saturation;
 
   /// Fluid density of each phase (at the qps)
-  const MaterialProperty<std::vector<Real> > * _fluid_density;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_density;
 
   /// Viscosity of each phase (at the qps)
-  const MaterialProperty<std::vector<Real> > * _fluid_viscosity;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_viscosity;
 
   /// Mass fraction of each component in each phase (at the qps)
-  const MaterialProperty<std::vector<std::vector<Real> > > * _mass_fractions;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<Real> > > * _mass_fractions;
 
   /// Relative permeability of each phase (at the qps)
-  const MaterialProperty<std::vector<Real> > * _relative_permeability;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _relative_permeability;
 
   /// PorousFlow Dictator UserObject
   const PorousFlowDictator & _dictator;
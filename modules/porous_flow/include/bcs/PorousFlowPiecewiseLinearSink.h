@@ -35,10 +35,10 @@ protected:
   const LinearInterpolation _sink_func;
 
   /// Nodal pore pressure in each phase
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _pp;
 
   /// d(Nodal pore pressure in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dpp_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dpp_dvar;
 
   virtual Real multiplier();
 
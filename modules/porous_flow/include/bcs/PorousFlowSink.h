@@ -73,31 +73,31 @@ protected:
   const MaterialProperty<RealTensorValue> & _permeability;
 
   /// d(Permeability)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<RealTensorValue> > & _dpermeability_dvar;
+  const MaterialProperty<PorousFlowVariableVector<RealTensorValue> > & _dpermeability_dvar;
 
   /// Fluid density for each phase (at the node)
-  const MaterialProperty<std::vector<Real> > & _fluid_density_node;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _fluid_density_node;
 
   /// d(Fluid density for each phase (at the node))/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dfluid_density_node_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dfluid_density_node_dvar;
 
   /// Viscosity of each component in each phase
-  const MaterialProperty<std::vector<Real> > & _fluid_viscosity;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _fluid_viscosity;
 
   /// d(Viscosity of each component in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dfluid_viscosity_dvar;
 
   /// Relative permeability of each phase
-  const MaterialProperty<std::vector<Real> > & _relative_permeability;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _relative_permeability;
 
   /// d(Relative permeability of each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _drelative_permeability_dvar;
 
   /// Mass fraction of each component in each phase
-  const MaterialProperty<std::vector<std::vector<Real> > > & _mass_fractions;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<Real> > > & _mass_fractions;
 
   /// d(Mass fraction of each component in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _dmass_fractions_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<PorousFlowVariableVector<Real> > > > & _dmass_fractions_dvar;
 
   /// Node Number information held in the quadpoints of the Materials
   const MaterialProperty<unsigned int> & _node_number;
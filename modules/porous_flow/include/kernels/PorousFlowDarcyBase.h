@@ -78,37 +78,37 @@ protected:
   const MaterialProperty<RealTensorValue> & _permeability;
 
   /// d(permeabiity)/d(porous-flow variable)
-  const MaterialProperty<std::vector<RealTensorValue> > & _dpermeability_dvar;
+  const MaterialProperty<PorousFlowVariableVector<RealTensorValue> > & _dpermeability_dvar;
 
   /// Fluid density for each phase (at the node)
-  const MaterialProperty<std::vector<Real> > & _fluid_density_node;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _fluid_density_node;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the node)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dfluid_density_node_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dfluid_density_node_dvar;
 
   /// Fluid density for each phase (at the qp)
-  const MaterialProperty<std::vector<Real> > & _fluid_density_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dfluid_density_qp_dvar;
 
   /// Viscosity of each component in each phase
-  const MaterialProperty<std::vector<Real> > & _fluid_viscosity;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _fluid_viscosity;
 
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dfluid_viscosity_dvar;
 
   /// Nodal pore pressure in each phase
-  const MaterialProperty<std::vector<Real> > & _pp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _pp;
 
   /// Gradient of the pore pressure in each phase
-  const MaterialProperty<std::vector<RealGradient> > & _grad_p;
+  const MaterialProperty<PorousFlowPhaseVector<RealGradient> > & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient> > > & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<RealGradient> > > & _dgrad_p_dvar;
 
   /// PorousFlow UserObject
   const PorousFlowDictator & _porousflow_dictator;
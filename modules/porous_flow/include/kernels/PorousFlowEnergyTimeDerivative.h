@@ -52,10 +52,10 @@ protected:
   const MaterialProperty<Real> & _porosity_old;
 
   /// d(porosity)/d(porous-flow variable) - these derivatives will be wrt variables at the nodes
-  const MaterialProperty<std::vector<Real> > & _dporosity_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _dporosity_dvar;
 
   /// d(porosity)/d(grad porous-flow variable) - remember these derivatives will be wrt grad(vars) at qps
-  const MaterialProperty<std::vector<RealGradient> > & _dporosity_dgradvar;
+  const MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dporosity_dgradvar;
 
   /// nodal rock energy density
   const MaterialProperty<Real> & _rock_energy_nodal;
@@ -64,34 +64,34 @@ protected:
   const MaterialProperty<Real> & _rock_energy_nodal_old;
 
   /// d(nodal rock energy density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<Real> > & _drock_energy_nodal_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _drock_energy_nodal_dvar;
 
   /// nodal fluid density
-  const MaterialProperty<std::vector<Real> > * _fluid_density;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_density;
 
   /// old value of nodal fluid density
-  const MaterialProperty<std::vector<Real> > * _fluid_density_old;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_density_old;
 
   /// d(nodal fluid density)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > * _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > * _dfluid_density_dvar;
 
   /// nodal fluid saturation
-  const MaterialProperty<std::vector<Real> > * _fluid_saturation_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_saturation_nodal;
 
   /// old value of fluid saturation
-  const MaterialProperty<std::vector<Real> > * _fluid_saturation_nodal_old;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _fluid_saturation_nodal_old;
 
   /// d(nodal fluid saturation)/d(porous-flow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > * _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > * _dfluid_saturation_nodal_dvar;
 
   /// internal energy of the phases, evaluated at the nodes
-  const MaterialProperty<std::vector<Real> > * _energy_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _energy_nodal;
 
   /// old value of internal energy of the phases, evaluated at the nodes
-  const MaterialProperty<std::vector<Real> > * _energy_nodal_old;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _energy_nodal_old;
 
   /// d(internal energy)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > * _denergy_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > * _denergy_nodal_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
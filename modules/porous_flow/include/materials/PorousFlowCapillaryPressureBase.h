@@ -30,10 +30,10 @@ protected:
   VariableName _saturation_variable_name;
 
   /// Saturation material property at the nodes
-  const MaterialProperty<std::vector<Real> > & _saturation_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_nodal;
 
   /// Saturation material property at the qps
-  const MaterialProperty<std::vector<Real> > & _saturation_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_qp;
 
   /// Capillary pressure material property at the nodes
   MaterialProperty<Real> & _capillary_pressure_nodal;
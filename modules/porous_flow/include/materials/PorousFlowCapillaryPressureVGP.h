@@ -45,10 +45,10 @@ protected:
   VariableName _pressure_variable_name;
 
   /// Pressure material property at the nodes
-  const MaterialProperty<std::vector<Real> > & _porepressure_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_nodal;
 
   /// Pressure material property at the qps
-  const MaterialProperty<std::vector<Real> > & _porepressure_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_qp;
 
   /// Derivative of capillary pressure at the nodes wrt phase pore pressure
   MaterialProperty<Real> & _dcapillary_pressure_nodal_dp;
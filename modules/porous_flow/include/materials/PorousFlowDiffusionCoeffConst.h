@@ -28,16 +28,16 @@ protected:
   virtual void computeQpProperties();
 
   /// Tortuosity tau_0 * tau_{alpha} for fluid phase alpha
-  MaterialProperty<std::vector<Real> > & _tortuosity;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _tortuosity;
 
   /// Derivative of tortuosity wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real> > > & _dtortuosity_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dtortuosity_dvar;
 
   /// Diffusion coefficients of component k in fluid phase alpha
-  MaterialProperty<std::vector<std::vector<Real> > > & _diffusion_coeff;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<Real> > > & _diffusion_coeff;
 
   /// Derivative of the diffusion coefficients wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _ddiffusion_coeff_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<PorousFlowVariableVector<Real> > > > & _ddiffusion_coeff_dvar;
 
   /// Input tortuosity
   const std::vector<Real> _input_tortuosity;
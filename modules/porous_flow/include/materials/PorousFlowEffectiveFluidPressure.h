@@ -31,40 +31,40 @@ protected:
   virtual void computeQpProperties();
 
   /// quadpoint porepressure of each phase
-  const MaterialProperty<std::vector<Real> > & _porepressure_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_qp;
 
   /// d(quadpoint porepressure)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dporepressure_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dporepressure_qp_dvar;
 
   /// quadpoint saturation of each phase
-  const MaterialProperty<std::vector<Real> > & _saturation_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_qp;
 
   /// d(quadpoint saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dsaturation_qp_dvar;
 
   /// nodal porepressure of each phase
-  const MaterialProperty<std::vector<Real> > & _porepressure_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_nodal;
 
   /// d(nodal porepressure)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dporepressure_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dporepressure_nodal_dvar;
 
   /// nodal saturation of each phase
-  const MaterialProperty<std::vector<Real> > & _saturation_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_nodal;
 
   /// d(nodal saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dsaturation_nodal_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dsaturation_nodal_dvar;
 
   /// computed effective fluid pressure (at quadpoints)
   MaterialProperty<Real> & _pf_qp;
 
   /// d(_pf_qp)/d(PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dpf_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dpf_qp_dvar;
 
   /// computed effective fluid pressure (at nodes)
   MaterialProperty<Real> & _pf_nodal;
 
   /// d(_pf_nodal)/d(PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dpf_nodal_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dpf_nodal_dvar;
 };
 
 #endif //POROUSFLOWEFFECTIVEFLUIDPRESSURE_H
@@ -29,10 +29,10 @@ protected:
   virtual void computeQpProperties();
 
   /// Pore pressure at the nodes
-  const MaterialProperty<std::vector<Real> > & _porepressure_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_nodal;
 
   /// Pore pressure at the qps
-  const MaterialProperty<std::vector<Real> > & _porepressure_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_qp;
 
   /// Fluid temperature at the nodes
   const MaterialProperty<Real> & _temperature_nodal;
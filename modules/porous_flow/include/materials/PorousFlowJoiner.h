@@ -66,22 +66,22 @@ protected:
   const bool _at_qps;
 
   /// Derivatives of porepressure variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dporepressure_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dporepressure_dvar;
 
   /// Derivatives of saturation variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real> > > & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dsaturation_dvar;
 
   /// Derivatives of temperature variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<Real> > & _dtemperature_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _dtemperature_dvar;
 
   /// computed property of the phase
-  MaterialProperty<std::vector<Real> > & _property;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _property;
 
   /// old value of property of the phase
-  MaterialProperty<std::vector<Real> > * const _property_old;
+  MaterialProperty<PorousFlowPhaseVector<Real> > * const _property_old;
 
   /// d(property)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dproperty_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dproperty_dvar;
 
   /// property of each phase
   std::vector<const MaterialProperty<Real> *> _phase_property;
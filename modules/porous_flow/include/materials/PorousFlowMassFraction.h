@@ -27,16 +27,16 @@ public:
 
 protected:
   /// Mass fraction matrix
-  MaterialProperty<std::vector<std::vector<Real> > > & _mass_frac;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<Real> > > & _mass_frac;
 
   /// Old value of mass fraction matrix
-  MaterialProperty<std::vector<std::vector<Real> > > & _mass_frac_old;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<Real> > > & _mass_frac_old;
 
   /// Gradient of the mass fraction matrix at the quad points
-  MaterialProperty<std::vector<std::vector<RealGradient> > > & _grad_mass_frac;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<RealGradient> > > & _grad_mass_frac;
 
   /// Derivative of the mass fraction matrix with respect to the porous flow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real> > > > & _dmass_frac_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowComponentVector<PorousFlowVariableVector<Real> > > > & _dmass_frac_dvar;
 
   virtual void initQpStatefulProperties();
   virtual void computeQpProperties();
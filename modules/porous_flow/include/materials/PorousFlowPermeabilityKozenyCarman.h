@@ -63,7 +63,7 @@ protected:
   const MaterialProperty<Real> & _porosity_qp;
 
   /// d(quadpoint porosity)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<Real> > & _dporosity_qp_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _dporosity_qp_dvar;
 
   /// Name of porosity-permeability relationship
   const MooseEnum _poroperm_function;
@@ -40,7 +40,7 @@ protected:
   MaterialProperty<RealTensorValue> & _permeability_qp;
 
   /// d(quadpoint permeability)/d(PorousFlow variable)
-  MaterialProperty<std::vector<RealTensorValue> > & _dpermeability_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<RealTensorValue> > & _dpermeability_qp_dvar;
 };
 
 #endif //POROUSFLOWPERMEABILITYUNITY_H
@@ -53,19 +53,19 @@ protected:
   const MaterialProperty<Real> & _vol_strain_qp;
 
   /// d(strain)/(dvar)
-  const MaterialProperty<std::vector<RealGradient> > & _dvol_strain_qp_dvar;
+  const MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dvol_strain_qp_dvar;
 
   /// effective nodal porepressure
   const MaterialProperty<Real> & _pf_nodal;
 
   /// d(effective nodal porepressure)/(d porflow variable)
-  const MaterialProperty<std::vector<Real> > & _dpf_nodal_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _dpf_nodal_dvar;
 
   /// effective qp porepressure
   const MaterialProperty<Real> & _pf_qp;
 
   /// d(effective qp porepressure)/(d porflow variable)
-  const MaterialProperty<std::vector<Real> > & _dpf_qp_dvar;
+  const MaterialProperty<PorousFlowVariableVector<Real> > & _dpf_qp_dvar;
 };
 
 #endif //POROUSFLOWPOROSITYHM_H
@@ -36,10 +36,10 @@ protected:
   MaterialProperty<Real> & _porosity_nodal_old;
 
   /// d(nodal porosity)/d(PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dporosity_nodal_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dporosity_nodal_dvar;
 
   /// d(nodal porosity)/d(PorousFlow variable)
-  MaterialProperty<std::vector<RealGradient> > & _dporosity_nodal_dgradvar;
+  MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dporosity_nodal_dgradvar;
 
   /// qaudpoint porosity
   MaterialProperty<Real> & _porosity_qp;
@@ -48,10 +48,10 @@ protected:
   MaterialProperty<Real> & _porosity_qp_old;
 
   /// d(quadpoint porosity)/d(PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dporosity_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dporosity_qp_dvar;
 
   /// d(quadpoint porosity)/d(PorousFlow variable)
-  MaterialProperty<std::vector<RealGradient> > & _dporosity_qp_dgradvar;
+  MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dporosity_qp_dgradvar;
 };
 
 #endif //POROUSFLOWPOROSITYUNITY_H
@@ -31,7 +31,7 @@ protected:
   VariableName _saturation_variable_name;
 
   /// Saturation material property
-  const MaterialProperty<std::vector<Real> > & _saturation_nodal;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_nodal;
 
   /// Relative permeability material property
   MaterialProperty<Real> & _relative_permeability;
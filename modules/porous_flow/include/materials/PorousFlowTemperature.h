@@ -66,16 +66,16 @@ protected:
   MaterialProperty<RealGradient> & _gradt_qp;
 
   /// d(nodal temperature)/d(nodal PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dtemperature_nodal_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dtemperature_nodal_dvar;
 
   /// d(quadpoint temperature)/d(quadpoint PorousFlow variable)
-  MaterialProperty<std::vector<Real> > & _dtemperature_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dtemperature_qp_dvar;
 
   /// d(grad temperature)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<Real> > & _dgradt_qp_dgradv;
+  MaterialProperty<PorousFlowVariableVector<Real> > & _dgradt_qp_dgradv;
 
   /// d(grad temperature)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<RealGradient> > & _dgradt_qp_dv;
+  MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dgradt_qp_dv;
 };
 
 #endif //POROUSFLOWTEMPERATURE_H
@@ -48,16 +48,16 @@ protected:
   const unsigned _aqueous_phase_number;
 
   /// Saturation of the fluid phases at the quadpoints
-  const MaterialProperty<std::vector<Real> > * _saturation_qp;
+  const MaterialProperty<PorousFlowPhaseVector<Real> > * _saturation_qp;
 
   /// d(Saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real> > > * _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > * _dsaturation_qp_dvar;
 
   /// Thermal conducitivity at the qps
   MaterialProperty<RealTensorValue> & _la_qp;
 
   /// d(thermal conductivity at the qps)/d(PorousFlow variable)
-  MaterialProperty<std::vector<RealTensorValue> > & _dla_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<RealTensorValue> > & _dla_qp_dvar;
 };
 
 #endif // POROUSFLOWTHERMALCONDUCTIVITYIDEAL_H
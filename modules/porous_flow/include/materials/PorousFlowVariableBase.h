@@ -47,52 +47,52 @@ protected:
   const MaterialProperty<unsigned int> & _node_number;
 
   /// Nodal values of porepressure of the phases
-  MaterialProperty<std::vector<Real> > & _porepressure_nodal;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_nodal;
 
   /// Old values of nodal porepressure of the phases
-  MaterialProperty<std::vector<Real> > & _porepressure_nodal_old;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_nodal_old;
 
   /// Quadpoint porepressure of the phases
-  MaterialProperty<std::vector<Real> > & _porepressure_qp;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _porepressure_qp;
 
   /// Grad(p) at the quadpoints
-  MaterialProperty<std::vector<RealGradient> > & _gradp_qp;
+  MaterialProperty<PorousFlowPhaseVector<RealGradient> > & _gradp_qp;
 
   /// d(nodal porepressure)/d(nodal PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dporepressure_nodal_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dporepressure_nodal_dvar;
 
   /// d(quadpoint porepressure)/d(quadpoint PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dporepressure_qp_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dporepressure_qp_dvar;
 
   /// d(grad porepressure)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real> > > & _dgradp_qp_dgradv;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dgradp_qp_dgradv;
 
   /// d(grad porepressure)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient> > > & _dgradp_qp_dv;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<RealGradient> > > & _dgradp_qp_dv;
 
   /// Nodal saturation of the phases
-  MaterialProperty<std::vector<Real> > & _saturation_nodal;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_nodal;
 
   /// Old value of nodal saturation of the phases
-  MaterialProperty<std::vector<Real> > & _saturation_nodal_old;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_nodal_old;
 
   /// Quadpoint saturation of the phases
-  MaterialProperty<std::vector<Real> > & _saturation_qp;
+  MaterialProperty<PorousFlowPhaseVector<Real> > & _saturation_qp;
 
   /// Grad(s) at the quadpoints
-  MaterialProperty<std::vector<RealGradient> > & _grads_qp;
+  MaterialProperty<PorousFlowPhaseVector<RealGradient> > & _grads_qp;
 
   /// d(nodal saturation)/d(nodal PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dsaturation_nodal_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dsaturation_nodal_dvar;
 
   /// d(quadpoint saturation)/d(quadpoint porflow variable)
-  MaterialProperty<std::vector<std::vector<Real> > > & _dsaturation_qp_dvar;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dsaturation_qp_dvar;
 
   /// d(grad saturation)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real> > > & _dgrads_qp_dgradv;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<Real> > > & _dgrads_qp_dgradv;
 
   /// d(grad saturation)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient> > > & _dgrads_qp_dv;
+  MaterialProperty<PorousFlowPhaseVector<PorousFlowVariableVector<RealGradient> > > & _dgrads_qp_dv;
 };
 
 #endif //POROUSFLOWVARIABLEBASE_H
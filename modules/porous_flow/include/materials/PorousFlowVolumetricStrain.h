@@ -48,7 +48,7 @@ protected:
    * Since the volumetric strain rate depends on derivatives of the displacement variables,
    * this should be multiplied by _grad_phi in kernels
    */
-  MaterialProperty<std::vector<RealGradient> > & _dvol_strain_rate_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dvol_strain_rate_qp_dvar;
 
   /// The total volumetric strain at the quadpoints
   MaterialProperty<Real> & _vol_total_strain_qp;
@@ -58,7 +58,7 @@ protected:
    * Since the total volumetric strain depends on derivatives of the displacement variables,
    * this should be multiplied by _grad_phi in kernels
    */
-  MaterialProperty<std::vector<RealGradient> > & _dvol_total_strain_qp_dvar;
+  MaterialProperty<PorousFlowVariableVector<RealGradient> > & _dvol_total_strain_qp_dvar;
 };
 
 #endif //POROUSFLOWVOLUMETRICSTRAIN_H
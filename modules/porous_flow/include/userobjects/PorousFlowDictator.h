@@ -11,6 +11,7 @@
 #include "GeneralUserObject.h"
 #include "Coupleable.h"
 #include "ZeroInterface.h"
+#include "PorousFlowTypes.h"
 
 class PorousFlowDictator;
 
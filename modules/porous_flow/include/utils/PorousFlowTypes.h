@@ -0,0 +1,47 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef POROUSFLOWTYPES_H
+#define POROUSFLOWTYPES_H
+
+#include "FixedCapacityVector.h"
+
+namespace PorousFlow
+{
+/**
+ * The maximum numbers of fluid phases, fluid components and PorousFlow variables.
+ * The vector-valued PorousFlow material properties store their entries inline
+ * with these capacities, and the PorousFlowDictator checks that a simulation
+ * does not exceed them.
+ *
+ * Every property value takes the space of the full capacities, whatever the
+ * actual numbers of phases, components and variables. For example a derivative
+ * of the mass fractions (phase x component x variable) takes 896 bytes per
+ * quadrature point and per stored state, where a std::vector based property
+ * of a single phase, single component, single variable problem takes about
+ * 120 bytes including the heap blocks. In exchange the properties never touch
+ * the heap and copying them between states is a plain memory copy. Reduce these
+ * capacities for memory bound simulations with few phases, components or variables.
+ */
+const unsigned int MAX_PHASES = 3;
+const unsigned int MAX_COMPONENTS = 4;
+const unsigned int MAX_VARIABLES = 8;
+}
+
+/// A quantity for each fluid phase
+template<typename T>
+using PorousFlowPhaseVector = FixedCapacityVector<T, PorousFlow::MAX_PHASES>;
+
+/// A quantity for each fluid component
+template<typename T>
+using PorousFlowComponentVector = FixedCapacityVector<T, PorousFlow::MAX_COMPONENTS>;
+
+/// A quantity for each PorousFlow variable, such as the derivatives of a property
+template<typename T>
+using PorousFlowVariableVector = FixedCapacityVector<T, PorousFlow::MAX_VARIABLES>;
+
+#endif //POROUSFLOWTYPES_H
@@ -9,10 +9,12 @@
 #ifndef GRAD2PARSEDFUNCTION_H
 #define GRAD2PARSEDFUNCTION_H
 
-#include "MooseParsedFunction.h"
+#include "Function.h"
+#include "MooseParsedFunctionBase.h"
 
 //Forward declarations
 class Grad2ParsedFunction;
+class MooseParsedFunctionWrapper;
 
 template<>
 InputParameters validParams<Grad2ParsedFunction>();
@@ -21,19 +23,29 @@ InputParameters validParams<Grad2ParsedFunction>();
  * returns the central difference approx to the derivative (direction.nabla)^2 function
  * viz
  * (f(t, p + direction) - 2*f(t, p) + f(t, p - direction))/|direction|^2
- * This derives from MooseParsedFunction, so it already knows about a function
+ * This takes the same parameters as MooseParsedFunction to define the function f
  */
 class Grad2ParsedFunction :
-  public MooseParsedFunction
+  public Function,
+  public MooseParsedFunctionBase
 {
 public:
 
   Grad2ParsedFunction(const InputParameters & parameters);
+  virtual ~Grad2ParsedFunction();
 
-  virtual Real value(Real t, const Point & pt);
+  virtual Real value(Real t, const Point & pt) override;
+
+  virtual void initialSetup() override;
 
 protected:
 
+  /// The function f defined by the user
+  std::string _value;
+
+  /// Pointer to the wrapper object for the function f
+  MooseParsedFunctionWrapper * _function_ptr;
+
   /// central difference direction
   RealVectorValue _direction;
 
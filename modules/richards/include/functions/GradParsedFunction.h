@@ -9,10 +9,12 @@
 #ifndef GRADPARSEDFUNCTION_H
 #define GRADPARSEDFUNCTION_H
 
-#include "MooseParsedFunction.h"
+#include "Function.h"
+#include "MooseParsedFunctionBase.h"
 
 //Forward declarations
 class GradParsedFunction;
+class MooseParsedFunctionWrapper;
 
 template<>
 InputParameters validParams<GradParsedFunction>();
@@ -21,19 +23,29 @@ InputParameters validParams<GradParsedFunction>();
  * returns the central difference approx to the derivative
  * of the function, ie
  * (f(t, p + direction) - f(t, p - direction))/2/|direction|
- * This derives from MooseParsedFunction, so it already knows about a function
+ * This takes the same parameters as MooseParsedFunction to define the function f
  */
 class GradParsedFunction :
-  public MooseParsedFunction
+  public Function,
+  public MooseParsedFunctionBase
 {
 public:
 
   GradParsedFunction(const InputParameters & parameters);
+  virtual ~GradParsedFunction();
 
-  virtual Real value(Real t, const Point & pt);
+  virtual Real value(Real t, const Point & pt) override;
+
+  virtual void initialSetup() override;
 
 protected:
 
+  /// The function f defined by the user
+  std::string _value;
+
+  /// Pointer to the wrapper object for the function f
+  MooseParsedFunctionWrapper * _function_ptr;
+
   /// central difference direction
   RealVectorValue _direction;
 
@@ -79,6 +79,8 @@ protected:
   bool _get_equivalent_k;
   bool _use_displaced_mesh;
   std::vector<unsigned int> _ring_vec;
+  /// Compute all of the integrals with a single JIntegralVectorPostprocessor
+  bool _single_pass;
 };
 
 #endif //DOMAININTEGRALACTION_H
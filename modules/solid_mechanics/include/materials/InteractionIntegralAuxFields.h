@@ -33,6 +33,26 @@ public:
   static std::vector<MooseEnum> getSIFModesVec(unsigned int n);
   static MooseEnum getSIFModesEnum();
 
+  enum SIF_MODE
+  {
+    KI,
+    KII,
+    KIII,
+    T
+  };
+
+  /**
+   * Compute the auxiliary fields of a stress intensity factor mode in the crack front
+   * coordinate system at the polar position (r, theta) relative to the crack front
+   */
+  static void computeAuxFields(const SIF_MODE sif_mode, Real r, Real theta, Real poissons_ratio, Real youngs_modulus,
+                               ColumnMajorMatrix & stress, ColumnMajorMatrix & disp, ColumnMajorMatrix & grad_disp, ColumnMajorMatrix & strain);
+
+  /**
+   * Compute the auxiliary stress and displacement gradient used for the T-stress at (r, theta)
+   */
+  static void computeTFields(Real r, Real theta, Real poissons_ratio, Real youngs_modulus, ColumnMajorMatrix & stress, ColumnMajorMatrix & grad_disp);
+
 protected:
   virtual void computeQpProperties();
 
@@ -54,25 +74,12 @@ protected:
   MaterialProperty<ColumnMajorMatrix> & _aux_grad_disp_T;
   MaterialProperty<ColumnMajorMatrix> & _aux_strain_T;
 
-  enum SIF_MODE
-  {
-    KI,
-    KII,
-    KIII,
-    T
-  };
-
-  void computeAuxFields(const SIF_MODE sif_mode, ColumnMajorMatrix & stress, ColumnMajorMatrix & disp, ColumnMajorMatrix & grad_disp, ColumnMajorMatrix & strain);
-  void computeTFields(ColumnMajorMatrix & stress, ColumnMajorMatrix & grad_disp);
-
 private:
   const CrackFrontDefinition * _crack_front_definition;
   const unsigned int _crack_front_point_index;
   std::vector<SIF_MODE> _sif_mode;
   Real _poissons_ratio;
   Real _youngs_modulus;
-  Real _kappa;
-  Real _shear_modulus;
   Real _r;
   Real _theta;
 
@@ -0,0 +1,160 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef JINTEGRALVECTORPOSTPROCESSOR_H
+#define JINTEGRALVECTORPOSTPROCESSOR_H
+
+#include "ElementVectorPostprocessor.h"
+#include "CrackFrontDefinition.h"
+#include "InteractionIntegralAuxFields.h"
+
+// libMesh includes
+#include "libmesh/fe_base.h"
+
+//Forward Declarations
+class JIntegralVectorPostprocessor;
+
+template<>
+InputParameters validParams<JIntegralVectorPostprocessor>();
+
+/**
+ * Computes the J-integral and the interaction integrals (KI, KII, KIII and T) for
+ * all rings and all crack front points in a single pass over the elements. The q
+ * functions are evaluated on the fly at the element nodes, either from the crack
+ * front geometry (like DomainIntegralQFunction) or from the element rings of the
+ * CrackFrontDefinition (like DomainIntegralTopologicalQFunction), and the auxiliary
+ * fields of the interaction integrals are evaluated at the quadrature points (like
+ * InteractionIntegralAuxFields). No q AuxVariables, auxiliary field materials or
+ * per-point postprocessors are needed.
+ *
+ * The output holds the vectors x, y, z and id with the coordinates of the crack front
+ * points and their position along the front, and one vector per integral and ring named
+ * like the per-ring vectors of the multi-pass DomainIntegral output: J_<ring> (K_<ring>
+ * if convert_J_to_K is set), II_KI_<ring>, II_KII_<ring>, II_KIII_<ring>, II_T_<ring>
+ * and Keq_<ring> if equivalent_k is set. Entry i of a vector is the value at crack
+ * front point i+1, e.g. entry i of II_KI_2 matches the II_KI_<i+1>_2 postprocessor.
+ */
+class JIntegralVectorPostprocessor : public ElementVectorPostprocessor
+{
+public:
+  JIntegralVectorPostprocessor(const InputParameters & parameters);
+
+  virtual void initialSetup();
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & y);
+  virtual void finalize();
+
+protected:
+  /// The integrals that can be computed, in the order of the "integrals" parameter options
+  enum INTEGRAL
+  {
+    J_INTEGRAL,
+    INTERACTION_INTEGRAL_KI,
+    INTERACTION_INTEGRAL_KII,
+    INTERACTION_INTEGRAL_KIII,
+    INTERACTION_INTEGRAL_T
+  };
+
+  /**
+   * Compute the geometric q function of a ring at a node for a crack front point
+   */
+  Real computeQFunction(const Node & node, unsigned int point_index, unsigned int ring_index) const;
+
+  /// Index of an integral value in _values
+  unsigned int valueIndex(unsigned int integral_index, unsigned int ring_index, unsigned int point_index) const
+  {
+    return (integral_index * _num_rings + ring_index) * _num_points + point_index;
+  }
+
+  const CrackFrontDefinition & _crack_front_definition;
+
+  /// Geometry or Topology
+  const MooseEnum _q_function_type;
+
+  /// Inner and outer radii of the rings (Geometry q function)
+  std::vector<Real> _radius_inner;
+  std::vector<Real> _radius_outer;
+
+  /// The ring numbers, used to name the vectors
+  std::vector<unsigned int> _ring_vec;
+  unsigned int _num_rings;
+
+  /// The integrals to compute
+  std::vector<INTEGRAL> _integrals;
+
+  /// Index of the J-integral in _integrals, or _integrals.size() if it is not computed
+  unsigned int _j_integral_index;
+
+  /// The auxiliary field modes of the interaction integrals, indexed like _integrals
+  std::vector<InteractionIntegralAuxFields::SIF_MODE> _sif_modes;
+
+  /// Conversion factors from the interaction integrals to the stress intensity factors, indexed like _integrals
+  std::vector<Real> _k_factors;
+
+  bool _has_interaction_integrals;
+  const bool _get_equivalent_k;
+
+  const MaterialProperty<ColumnMajorMatrix> * _Eshelby_tensor;
+  const MaterialProperty<RealVectorValue> * _J_thermal_term_vec;
+
+  /// Stress, strain and displacement gradients used by the interaction integrals
+  const MaterialProperty<SymmTensor> * _stress;
+  const MaterialProperty<SymmTensor> * _strain;
+  const VariableGradient & _grad_disp_x;
+  const VariableGradient & _grad_disp_y;
+  const VariableGradient & _grad_disp_z;
+
+  /// Temperature gradient and thermal expansion for the thermal term of the interaction integrals
+  const bool _has_temp;
+  const VariableGradient & _grad_temp;
+  const MaterialProperty<Real> * _current_instantaneous_thermal_expansion_coef;
+
+  const bool _convert_J_to_K;
+  const bool _has_symmetry_plane;
+  const Real _poissons_ratio;
+  const Real _youngs_modulus;
+  const MooseEnum _position_type;
+
+  bool _treat_as_2d;
+  unsigned int _num_points;
+
+  /// The finite element used to interpolate the q functions
+  std::unique_ptr<FEBase> _fe;
+  const std::vector<std::vector<Real> > & _phi;
+  const std::vector<std::vector<RealGradient> > & _grad_phi;
+
+  /// The quadrature rule currently attached to _fe
+  QBase * _fe_qrule;
+
+  /// The integrals indexed by valueIndex()
+  std::vector<Real> _values;
+
+  /// Nodal values of the q functions on the current element indexed by ring_index * n_nodes + node
+  std::vector<Real> _q_nodal;
+
+  /**
+   * The integrand of integral i at the current quadrature point is
+   * grad_q * _integrand_grad_q[i] + q * _integrand_q[i], with grad_q in global
+   * coordinates for the J-integral and in crack front coordinates otherwise
+   */
+  std::vector<RealVectorValue> _integrand_grad_q;
+  std::vector<Real> _integrand_q;
+
+  VectorPostprocessorValue & _x;
+  VectorPostprocessorValue & _y;
+  VectorPostprocessorValue & _z;
+  VectorPostprocessorValue & _position;
+
+  /// The output vectors indexed by integral_index * _num_rings + ring_index
+  std::vector<VectorPostprocessorValue *> _ring_values;
+
+  /// The equivalent K vectors of every ring
+  std::vector<VectorPostprocessorValue *> _equivalent_k_values;
+};
+
+#endif //JINTEGRALVECTORPOSTPROCESSOR_H
@@ -14,6 +14,7 @@
 
 #include "libmesh/vector_value.h"
 #include "libmesh/quadrature.h"
+#include "libmesh/mesh_tools.h"
 
 namespace Xfem
 {
@@ -82,6 +83,19 @@ public:
   Node * getNodeFromUniqueID(unique_id_type uid);
 
   void buildEFAMesh();
+
+  /**
+   * Update _efa_mesh around the cuts marked by the last update, instead of
+   * rebuilding it from the whole mesh
+   */
+  void updateEFAMesh();
+
+  /**
+   * Notify XFEM that the mesh has changed, so that _efa_mesh is rebuilt
+   * unless the change was made by XFEM itself
+   */
+  virtual void meshChanged();
+
   bool markCuts(Real time);
   bool markCutEdgesByGeometry(Real time);
   bool markCutEdgesByState(Real time);
@@ -164,6 +178,15 @@ private:
                         EFAElement3D* CEMElem,
                         std::vector<std::vector<Point> > &frag_faces) const;
 
+  /**
+   * Get the cuts whose bounding boxes intersect the bounding box of an element.
+   * Only these cuts can cut the element.
+   */
+  void getCutsNearElem(const Elem* elem,
+                       const std::vector<XFEMGeometricCut *> & cuts,
+                       const std::vector<MeshTools::BoundingBox> & cut_boxes,
+                       std::vector<XFEMGeometricCut *> & elem_cuts) const;
+
 private:
 
   /**
@@ -197,6 +220,15 @@ private:
   std::map<unique_id_type, unique_id_type> _new_node_to_parent_node;
 
   ElementFragmentAlgorithm _efa_mesh;
+
+  /// Whether _efa_mesh is up to date with the mesh, so that it does not need to be rebuilt
+  bool _efa_mesh_current;
+
+  /// Whether the last change of the mesh was made by update(), which keeps _efa_mesh current
+  bool _mesh_changed_by_xfem;
+
+  /// The ids of the elements added to the mesh by the last cutMeshWithEFA()
+  std::vector<dof_id_type> _new_elem_ids;
 };
 
 #endif // XFEM_H
@@ -17,6 +17,8 @@ public:
   XFEMCircleCut(std::vector<Real> square_nodes);
   ~XFEMCircleCut();
 
+  virtual MeshTools::BoundingBox getBoundingBox(Real time);
+
 private:
 
   std::vector<Point> _vertices;
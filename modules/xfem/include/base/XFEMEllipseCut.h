@@ -17,6 +17,8 @@ public:
   XFEMEllipseCut(std::vector<Real> square_nodes);
   ~XFEMEllipseCut();
 
+  virtual MeshTools::BoundingBox getBoundingBox(Real time);
+
 private:
 
   std::vector<Point> _vertices;
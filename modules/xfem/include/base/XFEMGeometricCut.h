@@ -11,6 +11,7 @@
 #include "libmesh/libmesh_common.h"
 #include "libmesh/libmesh.h" // libMesh::invalid_uint
 #include "libmesh/elem.h"
+#include "libmesh/mesh_tools.h"
 
 using namespace libMesh;
 
@@ -48,6 +49,12 @@ public:
   virtual bool cutFragmentByGeometry(std::vector<std::vector<Point> > & frag_faces,
                                     std::vector<CutFace> & cut_faces, Real time) = 0;
 
+  /**
+   * A box that contains the cut at a given time. Only elements that intersect
+   * the box are tested for cuts. The default box contains everything.
+   */
+  virtual MeshTools::BoundingBox getBoundingBox(Real time);
+
   Real cutFraction(Real time);
 
 protected:
@@ -19,6 +19,8 @@ public:
 
   virtual bool active(Real time);
 
+  virtual MeshTools::BoundingBox getBoundingBox(Real time);
+
   virtual bool cutElementByGeometry(const Elem* elem, std::vector<CutEdge> & cut_edges, Real time);
   virtual bool cutElementByGeometry(const Elem* elem, std::vector<CutFace> & cut_faces, Real time);
 
@@ -17,6 +17,8 @@ public:
   XFEMSquareCut(std::vector<Real> square_nodes);
   ~XFEMSquareCut();
 
+  virtual MeshTools::BoundingBox getBoundingBox(Real time);
+
 private:
   std::vector<Point> _vertices;
 
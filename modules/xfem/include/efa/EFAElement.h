@@ -14,6 +14,7 @@
 #include <ostream>
 
 class EFANode;
+class EFAInverseConnectivity;
 
 class EFAElement
 {
@@ -61,7 +62,7 @@ public:
   unsigned int numChildren() const;
   void addChild(EFAElement* child);
   void clearParentAndChildren();
-  void findGeneralNeighbors(std::map<EFANode*, std::set<EFAElement*> > &InverseConnectivity);
+  void findGeneralNeighbors(const EFAInverseConnectivity &InverseConnectivity);
   EFAElement* getGeneralNeighbor(unsigned int index) const;
   unsigned int numGeneralNeighbors() const;
 
@@ -79,7 +80,7 @@ public:
   virtual bool overlaysElement(const EFAElement* other_elem) const = 0;
   virtual unsigned int getNeighborIndex(const EFAElement * neighbor_elem) const = 0;
   virtual void clearNeighbors() = 0;
-  virtual void setupNeighbors(std::map<EFANode*, std::set<EFAElement*> > &InverseConnectivityMap) = 0;
+  virtual void setupNeighbors(const EFAInverseConnectivity &InverseConnectivity) = 0;
   virtual void neighborSanityCheck() const = 0;
 
   virtual void initCrackTip(std::set< EFAElement*> &CrackTipElements) = 0;
@@ -106,7 +107,7 @@ public:
   virtual void removePhantomEmbeddedNode() = 0;
   virtual void connectNeighbors(std::map<unsigned int, EFANode*> &PermanentNodes,
                                 std::map<unsigned int, EFANode*> &TempNodes,
-                                std::map<EFANode*, std::set<EFAElement*> > &InverseConnectivityMap,
+                                const EFAInverseConnectivity &InverseConnectivity,
                                 bool merge_phantom_edges) = 0;
   virtual void printElement(std::ostream & ostream) = 0;
 
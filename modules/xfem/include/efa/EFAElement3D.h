@@ -49,7 +49,7 @@ public:
   virtual bool overlaysElement(const EFAElement* other_elem) const;
   virtual unsigned int getNeighborIndex(const EFAElement* neighbor_elem) const;
   virtual void clearNeighbors();
-  virtual void setupNeighbors(std::map<EFANode*, std::set<EFAElement*> > &InverseConnectivityMap);
+  virtual void setupNeighbors(const EFAInverseConnectivity &InverseConnectivity);
   virtual void neighborSanityCheck() const;
 
   virtual void initCrackTip(std::set<EFAElement*> &CrackTipElements);
@@ -75,7 +75,7 @@ public:
   virtual void removePhantomEmbeddedNode();
   virtual void connectNeighbors(std::map<unsigned int, EFANode*> &PermanentNodes,
                                 std::map<unsigned int, EFANode*> &TempNodes,
-                                std::map<EFANode*, std::set<EFAElement*> > &InverseConnectivityMap,
+                                const EFAInverseConnectivity &InverseConnectivity,
                                 bool merge_phantom_faces);
   virtual void printElement(std::ostream &ostream);
 
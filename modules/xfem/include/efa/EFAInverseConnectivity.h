@@ -0,0 +1,65 @@
+/****************************************************************/
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*          All contents are licensed under LGPL V2.1           */
+/*             See LICENSE for full restrictions                */
+/****************************************************************/
+
+#ifndef EFAINVERSECONNECTIVITY_H
+#define EFAINVERSECONNECTIVITY_H
+
+#include <vector>
+
+class EFANode;
+class EFAElement;
+
+/**
+ * The elements connected to each permanent node of the mesh, stored in
+ * compressed sparse row format indexed by node id.
+ *
+ * Elements are first collected with addElement(), and the rows are built in a
+ * single pass over them by finalize(). The elements of each row are sorted by
+ * address, which is the order of the std::set this replaces.
+ */
+class EFAInverseConnectivity
+{
+public:
+  EFAInverseConnectivity();
+
+  /// Remove all elements
+  void clear();
+
+  /// Add an element to the rows of all of its nodes
+  void addElement(EFAElement* elem);
+
+  /// Build the rows from the elements added since the last call (if any)
+  void finalize();
+
+  /// The number of elements connected to a node
+  unsigned int numElements(const EFANode* node) const;
+
+  /// The elements connected to a node
+  EFAElement* const* elementsBegin(const EFANode* node) const;
+  EFAElement* const* elementsEnd(const EFANode* node) const;
+
+private:
+  /// The row of a node, or the number of rows if the node is not in the connectivity
+  unsigned int row(const EFANode* node) const;
+
+  /// The elements that have been added
+  std::vector<EFAElement*> _added_elements;
+
+  /// Whether the rows are up to date with _added_elements
+  bool _finalized;
+
+  /// The node of each row, used to tell apart nodes of other categories with the same id
+  std::vector<const EFANode*> _row_nodes;
+
+  /// The start of each row in _elements (with a trailing entry for the end of the last row)
+  std::vector<unsigned int> _row_offsets;
+
+  /// The connected elements of all rows
+  std::vector<EFAElement*> _elements;
+};
+
+#endif // EFAINVERSECONNECTIVITY_H
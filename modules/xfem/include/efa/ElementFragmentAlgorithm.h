@@ -14,6 +14,7 @@
 
 #include "EFANode.h"
 #include "EFAElement.h"
+#include "EFAInverseConnectivity.h"
 
 class ElementFragmentAlgorithm
 {
@@ -33,12 +34,26 @@ private:
   std::map< unsigned int, EFANode*> _embedded_nodes;
   std::map< unsigned int, EFANode*> _temp_nodes;
   std::map< unsigned int, EFAElement*> _elements;
+  /// The elements of _elements indexed by id (NULL for unused ids)
+  std::vector< EFAElement* > _elements_by_id;
 //  std::map< std::set< EFAnode* >, std::set< EFAelement* > > _merged_edge_map;
   std::set< EFAElement*> _crack_tip_elements;
   std::vector< EFANode* > _new_nodes;
   std::vector< EFAElement* > _child_elements;
   std::vector< EFAElement* > _parent_elements;
-  std::map< EFANode*, std::set< EFAElement *> > _inverse_connectivity;
+  EFAInverseConnectivity _inverse_connectivity;
+
+  /// Add an element to _elements and _elements_by_id
+  void insertElement(EFAElement* elem);
+
+  /// The element with an id, or NULL if there is none
+  EFAElement* findElemByID(unsigned int id) const;
+
+  /// Whether an element differs from a newly added element without cuts
+  bool isModified(const EFAElement* elem) const;
+
+  /// The nodes of the elements removed by removeModifiedElements()
+  std::set< EFANode* > _modified_nodes;
 
 public:
 
@@ -60,6 +75,23 @@ public:
   void updateTopology(bool mergeUncutVirtualEdges=true);
   void reset();
   void clearAncestry();
+
+  /**
+   * Remove the elements that differ from newly added elements: the parent and
+   * child elements of the last topology update and the elements with cuts,
+   * fragments or crack tip data.  Together with updateModifiedElements(), this
+   * updates the mesh around the cuts instead of resetting and rebuilding it.
+   * @param removed_ids The ids of the removed elements
+   */
+  void removeModifiedElements(std::vector<unsigned int> & removed_ids);
+
+  /**
+   * Update the neighbors of the elements added since removeModifiedElements()
+   * and of all elements sharing a node with them or with the removed elements,
+   * and rebuild the crack tip elements.
+   * @param added_ids The ids of the added elements
+   */
+  void updateModifiedElements(std::vector<unsigned int> added_ids);
   void restoreFragmentInfo(EFAElement * const elem, const EFAElement * const from_elem);
 
   void createChildElements();
@@ -0,0 +1,52 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef SHAREDDATATEST_H
+#define SHAREDDATATEST_H
+
+// MOOSE includes
+#include "ElementPostprocessor.h"
+
+// Forward declerations
+class SharedDataTest;
+
+template<>
+InputParameters validParams<SharedDataTest>();
+
+/**
+ * An object for testing SharedDataInterface.  It errors if its thread copies do
+ * not hold the same shared data and reports how many times the data was built.
+ */
+class SharedDataTest : public ElementPostprocessor
+{
+public:
+  SharedDataTest(const InputParameters & parameters);
+  virtual void initialize();
+  virtual void execute();
+  virtual void threadJoin(const UserObject & uo);
+  virtual void finalize();
+  virtual PostprocessorValue getValue();
+
+protected:
+  /// The number of times this copy built the shared data
+  unsigned int _n_builds;
+
+  /// The number of times the shared data was built by all of the thread copies
+  unsigned int _total_builds;
+
+  /// The data shared by all of the thread copies
+  MooseSharedPointer<const std::vector<Real> > _data;
+};
+
+#endif //SHAREDDATATEST_H
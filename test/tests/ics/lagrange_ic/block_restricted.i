@@ -0,0 +1,66 @@
+# A first order Lagrange variable with an initial condition on one block only.
+# The initial condition is set on all nodes of its block (including the nodes
+# shared with the other block) and nowhere else.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+  xmax = 4
+[]
+
+[MeshModifiers]
+  [./right_block]
+    type = SubdomainBoundingBox
+    bottom_left = '2 -1 -1'
+    top_right = '4 1 1'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[ICs]
+  [./left]
+    type = FunctionIC
+    variable = u
+    function = -x
+    block = 0
+  [../]
+[]
+
+[Postprocessors]
+  [./u1]
+    type = PointValue
+    variable = u
+    point = '1 0 0'
+    execute_on = initial
+  [../]
+  [./u2]
+    type = PointValue
+    variable = u
+    point = '2 0 0'
+    execute_on = initial
+  [../]
+  [./u3]
+    type = PointValue
+    variable = u
+    point = '3 0 0'
+    execute_on = initial
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 0
+[]
+
+[Outputs]
+  csv = true
+[]
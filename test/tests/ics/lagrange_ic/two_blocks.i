@@ -0,0 +1,75 @@
+# A first order Lagrange variable with a pointwise initial condition on one block
+# and a random initial condition on the other. The node shared by the blocks gets
+# its value from the element visited last (in the right block), like it did before
+# pointwise initial conditions were set node by node. The random values are confined
+# to a tiny range to make them reproducible.
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+  xmax = 4
+[]
+
+[MeshModifiers]
+  [./right_block]
+    type = SubdomainBoundingBox
+    bottom_left = '2 -1 -1'
+    top_right = '4 1 1'
+    block_id = 1
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[ICs]
+  [./left]
+    type = FunctionIC
+    variable = u
+    function = -x
+    block = 0
+  [../]
+  [./right]
+    type = RandomIC
+    variable = u
+    min = 2
+    max = 2.000000001
+    block = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u1]
+    type = PointValue
+    variable = u
+    point = '1 0 0'
+    execute_on = initial
+  [../]
+  [./u2]
+    type = PointValue
+    variable = u
+    point = '2 0 0'
+    execute_on = initial
+  [../]
+  [./u3]
+    type = PointValue
+    variable = u
+    point = '3 0 0'
+    execute_on = initial
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 0
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,70 @@
+###########################################################
+# This is a test of MultiApp load balancing. The sub-apps
+# have very different costs so they are redistributed
+# across the processors based on their measured solve time.
+#
+# Every App solves du/dt = 1 with u(0) = 0, so u = t exactly
+# and the output does not depend on where the Apps are solved.
+###########################################################
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+  [./td]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./source]
+    type = BodyForce
+    variable = u
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./u_avg]
+    type = ElementAverageValue
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 6
+  dt = 0.2
+
+  # Preconditioned JFNK (default)
+  solve_type = 'PJFNK'
+
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
+
+[MultiApps]
+  [./sub_app]
+    positions = '0 0 0  0.5 0.5 0  0.6 0.6 0  0.7 0.7 0'
+    type = TransientMultiApp
+    input_files = 'sub_large.i sub_large.i sub_small.i sub_small.i'
+    app_type = MooseTestApp
+    load_balance = true
+    load_balance_interval = 2
+  [../]
+[]
@@ -51,6 +51,10 @@
   [../]
 []
 
+[Problem]
+  type = FEProblem
+[]
+
 [Executioner]
   type = Transient
   num_steps = 20
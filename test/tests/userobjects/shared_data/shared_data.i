@@ -0,0 +1,59 @@
+# Each of the SharedDataTest postprocessors errors if its thread copies do not
+# share the same data and reports the number of times the data was built,
+# which must be one regardless of the number of threads.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Postprocessors]
+  [./builds_a]
+    type = SharedDataTest
+    execute_on = 'initial timestep_end'
+  [../]
+  [./builds_b]
+    type = SharedDataTest
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+[]
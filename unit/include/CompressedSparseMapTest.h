@@ -0,0 +1,43 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef COMPRESSEDSPARSEMAPTEST_H
+#define COMPRESSEDSPARSEMAPTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class CompressedSparseMapTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( CompressedSparseMapTest );
+
+  CPPUNIT_TEST( denseKeys );
+  CPPUNIT_TEST( sparseKeys );
+  CPPUNIT_TEST( uniqueValues );
+  CPPUNIT_TEST( visitorBuild );
+  CPPUNIT_TEST( threadedBuild );
+  CPPUNIT_TEST( insertNewKeys );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void denseKeys();
+  void sparseKeys();
+  void uniqueValues();
+  void visitorBuild();
+  void threadedBuild();
+  void insertNewKeys();
+};
+
+#endif  // COMPRESSEDSPARSEMAPTEST_H
@@ -35,6 +35,7 @@ class ElementFragmentAlgorithmTest : public CppUnit::TestFixture
   CPPUNIT_TEST( ElementFragmentAlgorithmTest5a );
   CPPUNIT_TEST( ElementFragmentAlgorithmTest5b );
   CPPUNIT_TEST( ElementFragmentAlgorithmTest5c );
+  CPPUNIT_TEST( ElementFragmentAlgorithmTest5d );
   CPPUNIT_TEST( ElementFragmentAlgorithmTest6a );
   CPPUNIT_TEST( ElementFragmentAlgorithmTest6b );
 
@@ -61,6 +62,7 @@ public:
   void ElementFragmentAlgorithmTest5a();
   void ElementFragmentAlgorithmTest5b();
   void ElementFragmentAlgorithmTest5c();
+  void ElementFragmentAlgorithmTest5d();
 
   void case6Mesh(ElementFragmentAlgorithm &MyMesh);
   void ElementFragmentAlgorithmTest6a();
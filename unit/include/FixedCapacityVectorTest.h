@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FIXEDCAPACITYVECTORTEST_H
+#define FIXEDCAPACITYVECTORTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class FixedCapacityVectorTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FixedCapacityVectorTest );
+
+  CPPUNIT_TEST( resize );
+  CPPUNIT_TEST( assign );
+  CPPUNIT_TEST( nested );
+  CPPUNIT_TEST( storeLoad );
+  CPPUNIT_TEST( overflow );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void resize();
+  void assign();
+  void nested();
+  void storeLoad();
+  void overflow();
+};
+
+#endif  // FIXEDCAPACITYVECTORTEST_H
@@ -0,0 +1,64 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FLUIDPROPERTIESBATCHTEST_H
+#define FLUIDPROPERTIESBATCHTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// C++ includes
+#include <string>
+
+// Forward declarations
+class MooseMesh;
+class FEProblem;
+class Factory;
+class MooseApp;
+class InputParameters;
+
+/**
+ * Checks that the batch (array) versions of the fluid properties give the same
+ * values as the pointwise versions
+ */
+class FluidPropertiesBatchTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( FluidPropertiesBatchTest );
+
+  CPPUNIT_TEST( idealGas );
+  CPPUNIT_TEST( stiffenedGas );
+  CPPUNIT_TEST( water97 );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void idealGas();
+  void stiffenedGas();
+  void water97();
+
+  void init();
+  void finalize();
+
+protected:
+  /// Parameters for a fluid properties object of the given type
+  InputParameters fluidParams(const std::string & type);
+
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+  FEProblem * _fe_problem;
+};
+
+#endif  // FLUIDPROPERTIESBATCHTEST_H
@@ -0,0 +1,48 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FORMATTEDTABLETEST_H
+#define FORMATTEDTABLETEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+#include <string>
+
+class FormattedTable;
+
+class FormattedTableTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FormattedTableTest );
+
+  CPPUNIT_TEST( binaryReadBack );
+  CPPUNIT_TEST( csvIncremental );
+  CPPUNIT_TEST( csvAlignLastRow );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void binaryReadBack();
+  void csvIncremental();
+  void csvAlignLastRow();
+
+private:
+  /// Read back a binary file and compare it with the table
+  void checkBinary(const FormattedTable & table, const std::string & file_name);
+
+  /// Compare a csv file written incrementally with the csv file of the same data written from scratch
+  void checkCSV(const FormattedTable & table, const std::string & file_name, bool align);
+};
+
+#endif  // FORMATTEDTABLETEST_H
@@ -0,0 +1,34 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+
+#ifndef FUNCTIONPARSERUTILSTEST_H
+#define FUNCTIONPARSERUTILSTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class FunctionParserUtilsTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( FunctionParserUtilsTest );
+
+  CPPUNIT_TEST( jitCacheReusesCompiledObject );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void jitCacheReusesCompiledObject();
+};
+
+#endif  // FUNCTIONPARSERUTILSTEST_H
@@ -0,0 +1,61 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef FUNCTIONVALUESTEST_H
+#define FUNCTIONVALUESTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class FEProblem;
+class Factory;
+class MooseApp;
+
+/**
+ * Checks that the multi-point evaluation of functions (Function::values(), gradients() and
+ * timeDerivatives()) gives the same results as evaluating the points one by one
+ */
+class FunctionValuesTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( FunctionValuesTest );
+
+  CPPUNIT_TEST( piecewiseLinear );
+  CPPUNIT_TEST( piecewiseLinearAxis );
+  CPPUNIT_TEST( piecewiseBilinear );
+  CPPUNIT_TEST( solutionFunction );
+  CPPUNIT_TEST( parsedFunction );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void piecewiseLinear();
+  void piecewiseLinearAxis();
+  void piecewiseBilinear();
+  void solutionFunction();
+  void parsedFunction();
+
+  void init();
+  void finalize();
+
+protected:
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+  FEProblem * _fe_problem;
+};
+
+#endif  // FUNCTIONVALUESTEST_H
@@ -0,0 +1,41 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef THREADEDLOOPSCHEDULERTEST_H
+#define THREADEDLOOPSCHEDULERTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+class ThreadedLoopSchedulerTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE( ThreadedLoopSchedulerTest );
+
+  CPPUNIT_TEST( visitsAllItems );
+  CPPUNIT_TEST( staticByDefault );
+  CPPUNIT_TEST( balancesChunks );
+  CPPUNIT_TEST( resetsChangedRanges );
+  CPPUNIT_TEST( printsBalance );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void visitsAllItems();
+  void staticByDefault();
+  void balancesChunks();
+  void resetsChangedRanges();
+  void printsBalance();
+};
+
+#endif  // THREADEDLOOPSCHEDULERTEST_H
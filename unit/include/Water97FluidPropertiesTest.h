@@ -0,0 +1,59 @@
+/****************************************************************/
+/*               DO NOT MODIFY THIS HEADER                      */
+/* MOOSE - Multiphysics Object Oriented Simulation Environment  */
+/*                                                              */
+/*           (c) 2010 Battelle Energy Alliance, LLC             */
+/*                   ALL RIGHTS RESERVED                        */
+/*                                                              */
+/*          Prepared by Battelle Energy Alliance, LLC           */
+/*            Under Contract No. DE-AC07-05ID14517              */
+/*            With the U. S. Department of Energy               */
+/*                                                              */
+/*            See COPYRIGHT for full restrictions               */
+/****************************************************************/
+
+#ifndef WATER97FLUIDPROPERTIESTEST_H
+#define WATER97FLUIDPROPERTIESTEST_H
+
+//CPPUnit includes
+#include "GuardedHelperMacros.h"
+
+// Forward declarations
+class MooseMesh;
+class FEProblem;
+class Factory;
+class MooseApp;
+class Water97FluidProperties;
+
+class Water97FluidPropertiesTest : public CppUnit::TestFixture
+{
+
+  CPPUNIT_TEST_SUITE( Water97FluidPropertiesTest );
+
+  CPPUNIT_TEST( region1 );
+  CPPUNIT_TEST( region2 );
+  CPPUNIT_TEST( region3 );
+  CPPUNIT_TEST( region5 );
+  CPPUNIT_TEST( properties );
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void region1();
+  void region2();
+  void region3();
+  void region5();
+  void properties();
+
+  void init();
+  void finalize();
+
+protected:
+  MooseApp * _app;
+  Factory * _factory;
+  MooseMesh * _mesh;
+  FEProblem * _fe_problem;
+  Water97FluidProperties * _fp;
+};
+
+#endif  // WATER97FLUIDPROPERTIESTEST_H